@@ -21,12 +21,14 @@ public:
     void testIfNot();
     void testIfAndNot();
     void testNENot();
+    void testNumericOperands();
 
     CPPUNIT_TEST_SUITE(Language_Conditionals);
 
     CPPUNIT_TEST(testIfNot);
     CPPUNIT_TEST(testIfAndNot);
     CPPUNIT_TEST(testNENot);
+    CPPUNIT_TEST(testNumericOperands);
 
     CPPUNIT_TEST_SUITE_END();
 };
@@ -159,6 +161,36 @@ void Language_Conditionals::testNENot()
     }
 }
 
+void Language_Conditionals::testNumericOperands()
+{
+    { // need a block to ensure MacroSnippet is cleaned properly
+        MacroSnippet myMacro("Option VBASupport 0\n"
+                             "Option Explicit\n"
+                             "\n"
+                             "Function doUnitTest() As Integer\n"
+                             "Dim i As Integer\n"
+                             "Dim nMax As Integer\n"
+                             "Dim nSum As Long\n"
+                             "Dim fHalf As Double\n"
+                             "nMax = 32767\n"
+                             "fHalf = 0.5\n"
+                             "For i = 1 To 100\n"
+                             "nSum = nSum + i * 2 - 1\n"
+                             "Next i\n"
+                             "If nSum = 10000 And i / 4 = 25.25 And fHalf < i And i - fHalf >= 100.5 "
+                             "And nMax + i = 32868 And nSum <> nMax Then\n"
+                             "doUnitTest = 1\n"
+                             "Else\n"
+                             "doUnitTest = 0\n"
+                             "End If\n"
+                             "End Function\n");
+        myMacro.Compile();
+        CPPUNIT_ASSERT(!myMacro.HasError());
+        SbxVariableRef pNew = myMacro.Run();
+        CPPUNIT_ASSERT_EQUAL(static_cast<sal_Int16>(1), pNew->GetInteger());
+    }
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(Language_Conditionals);
 
 } // namespace
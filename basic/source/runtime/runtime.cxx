@@ -70,6 +70,7 @@
 #include <sbunoobj.hxx>
 #include <basic/codecompletecache.hxx>
 #include <memory>
+#include <typeinfo>
 
 using com::sun::star::uno::Reference;
 
@@ -1026,7 +1027,7 @@ SbxVariableRef SbiRuntime::PopVar()
     SbxVariableRef xVar = refExprStk->Get(--nExprLvl);
     SAL_INFO_IF( xVar->GetName() == "Cells", "basic", "PopVar: Name equals 'Cells'" );
     // methods hold themselves in parameter 0
-    if( dynamic_cast<const SbxMethod *>(xVar.get()) != nullptr )
+    if( xVar->GetClass() == SbxClassType::Method )
     {
         xVar->SetParameters(nullptr);
     }
@@ -1305,6 +1306,41 @@ sal_uInt16 SbiRuntime::GetBase() const
 void SbiRuntime::StepNOP()
 {}
 
+namespace
+{
+    // Plain Integer, Long and Double variables (locals, constants and
+    // temporaries) have no broadcaster and no default property, so their
+    // value can be used directly instead of going through SbxValue::Get.
+    // SbxValue::Compute and SbxValue::Compare calculate on a Double basis for
+    // these types as well, so the results are identical.
+    bool lcl_GetPlainNumber( const SbxVariable& rVar, double& rValue )
+    {
+        if( typeid(rVar) != typeid(SbxVariable) || rVar.IsBroadcaster() || !rVar.CanRead() )
+            return false;
+        const SbxValues& rData = rVar.GetValues_Impl();
+        switch( rData.eType )
+        {
+            case SbxINTEGER: rValue = rData.nInteger; return true;
+            case SbxLONG:    rValue = rData.nLong;    return true;
+            case SbxDOUBLE:  rValue = rData.nDouble;  return true;
+            default:         return false;
+        }
+    }
+
+    bool lcl_CompareNumbers( SbxOperator eOp, double fLeft, double fRight )
+    {
+        switch( eOp )
+        {
+            case SbxEQ: return fLeft == fRight;
+            case SbxNE: return fLeft != fRight;
+            case SbxLT: return fLeft <  fRight;
+            case SbxGT: return fLeft >  fRight;
+            case SbxLE: return fLeft <= fRight;
+            default:    return fLeft >= fRight;
+        }
+    }
+}
+
 void SbiRuntime::StepArith( SbxOperator eOp )
 {
     SbxVariableRef p1 = PopVar();
@@ -1320,7 +1356,24 @@ void SbiRuntime::StepArith( SbxOperator eOp )
     }
 
     p2->ResetFlag( SbxFlagBits::Fixed );
-    p2->Compute( eOp, *p1 );
+
+    double fLeft, fRight;
+    if( ( eOp == SbxPLUS || eOp == SbxMINUS || eOp == SbxMUL || eOp == SbxDIV )
+        && !SbxBase::IsError() && p2->CanWrite()
+        && lcl_GetPlainNumber( *p2, fLeft ) && lcl_GetPlainNumber( *p1, fRight )
+        && ( eOp != SbxDIV || fRight != 0.0 ) )
+    {
+        switch( eOp )
+        {
+            case SbxPLUS:  fLeft += fRight; break;
+            case SbxMINUS: fLeft -= fRight; break;
+            case SbxMUL:   fLeft *= fRight; break;
+            default:       fLeft /= fRight; break;
+        }
+        p2->PutDouble( fLeft );
+    }
+    else
+        p2->Compute( eOp, *p1 );
 
     checkArithmeticOverflow( p2 );
 }
@@ -1389,6 +1442,10 @@ void SbiRuntime::StepCompare( SbxOperator eOp )
         }
 
     }
+    double fLeft, fRight;
+    const bool bPlainNumbers = !SbxBase::IsError()
+        && lcl_GetPlainNumber( *p2, fLeft ) && lcl_GetPlainNumber( *p1, fRight );
+
     static SbxVariable* pTRUE = nullptr;
     static SbxVariable* pFALSE = nullptr;
     // why do this on non-windows ?
@@ -1404,7 +1461,7 @@ void SbiRuntime::StepCompare( SbxOperator eOp )
         }();
         PushVar( pNULL );
     }
-    else if( p2->Compare( eOp, *p1 ) )
+    else if( bPlainNumbers ? lcl_CompareNumbers( eOp, fLeft, fRight ) : p2->Compare( eOp, *p1 ) )
     {
         if( !pTRUE )
         {
@@ -134,10 +134,8 @@ void OBoolOperator::Exec(OCodeStack& rCodeStack)
     rCodeStack.pop();
 
     rCodeStack.push(new OOperandResultBOOL(operate(pLeft, pRight)));
-    if( typeid(OOperandResult) == typeid(*pLeft))
-        delete pLeft;
-    if( typeid(OOperandResult) == typeid(*pRight))
-        delete pRight;
+    deleteIfResult(pLeft);
+    deleteIfResult(pRight);
 }
 
 bool OOp_NOT::operate(const OOperand* pLeft, const OOperand* ) const
@@ -152,8 +150,7 @@ void OOp_NOT::Exec(OCodeStack& rCodeStack)
 
     rCodeStack.push(new OOperandResultBOOL(operate(pOperand, nullptr)));
 
-    if( typeid(OOperandResult) == typeid(*pOperand))
-        delete pOperand;
+    deleteIfResult(pOperand);
 }
 
 bool OOp_AND::operate(const OOperand* pLeft, const OOperand* pRight) const
@@ -174,8 +171,7 @@ void OOp_ISNULL::Exec(OCodeStack& rCodeStack)
     rCodeStack.pop();
 
     rCodeStack.push(new OOperandResultBOOL(operate(pOperand, nullptr)));
-    if( typeid(OOperandResult) == typeid(*pOperand))
-        delete pOperand;
+    deleteIfResult(pOperand);
 }
 
 
@@ -286,10 +282,8 @@ void ONumOperator::Exec(OCodeStack& rCodeStack)
     rCodeStack.pop();
 
     rCodeStack.push(new OOperandResultNUM(operate(pLeft->getValue().getDouble(), pRight->getValue().getDouble())));
-    if( typeid(OOperandResult) == typeid(*pLeft))
-        delete pLeft;
-    if( typeid(OOperandResult) == typeid(*pRight))
-        delete pRight;
+    deleteIfResult(pLeft);
+    deleteIfResult(pRight);
 }
 
 double OOp_ADD::operate(const double& fLeft,const double& fRight) const
@@ -336,8 +330,7 @@ void ONthOperator::Exec(OCodeStack& rCodeStack)
 
     for (const auto& rpOperand : aOperands)
     {
-        if (typeid(OOperandResult) == typeid(*rpOperand))
-            delete rpOperand;
+        deleteIfResult(rpOperand);
     }
 }
 
@@ -352,10 +345,8 @@ void OBinaryOperator::Exec(OCodeStack& rCodeStack)
         rCodeStack.pop();
 
     rCodeStack.push(new OOperandResult(operate(pLeft->getValue(),pRight->getValue())));
-    if(typeid(OOperandResult) == typeid(*pRight))
-        delete pRight;
-    if(typeid(OOperandResult) == typeid(*pLeft))
-        delete pLeft;
+    deleteIfResult(pRight);
+    deleteIfResult(pLeft);
 }
 
 void OUnaryOperator::Exec(OCodeStack& rCodeStack)
@@ -365,8 +356,7 @@ void OUnaryOperator::Exec(OCodeStack& rCodeStack)
     rCodeStack.pop();
 
     rCodeStack.push(new OOperandResult(operate(pOperand->getValue())));
-    if (typeid(OOperandResult) == typeid(*pOperand))
-        delete pOperand;
+    deleteIfResult(pOperand);
 }
 
 
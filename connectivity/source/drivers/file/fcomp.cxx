@@ -549,8 +549,7 @@ bool OPredicateInterpreter::evaluate(OCodeList& rCodeList)
     DBG_ASSERT(pOperand, "Stack error");
 
     const bool bResult = pOperand->isValid();
-    if (typeid(OOperandResult) == typeid(*pOperand))
-        delete pOperand;
+    deleteIfResult(pOperand);
     return bResult;
 }
 
@@ -575,8 +574,7 @@ void OPredicateInterpreter::evaluateSelection(OCodeList& rCodeList, ORowSetValue
     DBG_ASSERT(pOperand, "Stack error");
 
     (*_rVal) = pOperand->getValue();
-    if (typeid(OOperandResult) == typeid(*pOperand))
-        delete pOperand;
+    deleteIfResult(pOperand);
 }
 
 void OPredicateCompiler::execute_Fold(OSQLParseNode const * pPredicateNode)
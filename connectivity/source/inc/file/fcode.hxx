@@ -162,6 +162,15 @@ namespace connectivity
             }
         };
 
+        /** intermediate results are pushed by the operators and owned by the
+            code stack, all other operands belong to the code list
+        */
+        inline void deleteIfResult(OOperand* pOperand)
+        {
+            if (dynamic_cast<OOperandResult*>(pOperand))
+                delete pOperand;
+        }
+
         /** special stop operand
             is appended when a list of arguments ends
         */
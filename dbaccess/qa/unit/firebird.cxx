@@ -9,11 +9,17 @@
 
 #include "dbtest_base.cxx"
 
+#include <com/sun/star/beans/XPropertySet.hpp>
+#include <com/sun/star/sdb/CommandType.hpp>
 #include <com/sun/star/sdb/XOfficeDatabaseDocument.hpp>
+#include <com/sun/star/sdb/XResultSetAccess.hpp>
+#include <com/sun/star/sdbc/ResultSetType.hpp>
+#include <com/sun/star/sdbc/SQLException.hpp>
 #include <com/sun/star/sdbc/XColumnLocate.hpp>
 #include <com/sun/star/sdbc/XConnection.hpp>
 #include <com/sun/star/sdbc/XResultSet.hpp>
 #include <com/sun/star/sdbc/XRow.hpp>
+#include <com/sun/star/sdbc/XRowSet.hpp>
 #include <com/sun/star/sdbc/XStatement.hpp>
 
 using namespace ::com::sun::star;
@@ -28,12 +34,17 @@ public:
     void testEmptyDBConnection();
     void testIntegerDatabase();
     void testTdf132924();
+    void testForwardOnlyRowSetClone();
 
     CPPUNIT_TEST_SUITE(FirebirdTest);
     CPPUNIT_TEST(testEmptyDBConnection);
     CPPUNIT_TEST(testIntegerDatabase);
     CPPUNIT_TEST(testTdf132924);
+    CPPUNIT_TEST(testForwardOnlyRowSetClone);
     CPPUNIT_TEST_SUITE_END();
+
+private:
+    uno::Reference<XRowSet> createForwardOnlyRowSet(uno::Reference<XConnection> const& xConnection);
 };
 
 /**
@@ -118,6 +129,88 @@ void FirebirdTest::testTdf132924()
     closeDocument(uno::Reference<lang::XComponent>(xDocument, uno::UNO_QUERY));
 }
 
+uno::Reference<XRowSet>
+FirebirdTest::createForwardOnlyRowSet(uno::Reference<XConnection> const& xConnection)
+{
+    uno::Reference<XRowSet> xRowSet(m_xSFactory->createInstance("com.sun.star.sdb.RowSet"),
+                                    UNO_QUERY_THROW);
+    uno::Reference<beans::XPropertySet> xProps(xRowSet, UNO_QUERY_THROW);
+    xProps->setPropertyValue("ActiveConnection", Any(xConnection));
+    xProps->setPropertyValue("CommandType", Any(CommandType::COMMAND));
+    xProps->setPropertyValue("Command", Any(OUString("SELECT ID FROM NOKEY ORDER BY ID")));
+    xProps->setPropertyValue("ResultSetType", Any(ResultSetType::FORWARD_ONLY));
+    xProps->setPropertyValue("FetchSize", Any(sal_Int32(10)));
+    xRowSet->execute();
+    return xRowSet;
+}
+
+/**
+ * A forward only row set over a table without a primary key drops the rows
+ * it has passed. A clone must either see all rows or not be created at all.
+ */
+void FirebirdTest::testForwardOnlyRowSetClone()
+{
+    auto const tmp = createTempCopy(u"firebird_empty.odb");
+    uno::Reference<XOfficeDatabaseDocument> xDocument = getDocumentForUrl(tmp.GetURL());
+    uno::Reference<XConnection> xConnection = getConnectionForDocument(xDocument);
+
+    uno::Reference<XStatement> xStatement = xConnection->createStatement();
+    xStatement->executeUpdate("CREATE TABLE NOKEY (ID INTEGER)");
+    for (sal_Int32 i = 1; i <= 25; ++i)
+        xStatement->executeUpdate("INSERT INTO NOKEY VALUES (" + OUString::number(i) + ")");
+
+    // A clone made up front keeps the rows alive while the row set moves on.
+    {
+        uno::Reference<XRowSet> xRowSet = createForwardOnlyRowSet(xConnection);
+        uno::Reference<XResultSetAccess> xAccess(xRowSet, UNO_QUERY_THROW);
+        uno::Reference<XResultSet> xClone = xAccess->createResultSet();
+        CPPUNIT_ASSERT(xClone.is());
+
+        sal_Int32 nRows = 0;
+        while (xRowSet->next())
+            ++nRows;
+        CPPUNIT_ASSERT_EQUAL(sal_Int32(25), nRows);
+
+        uno::Reference<XRow> xCloneRow(xClone, UNO_QUERY_THROW);
+        for (sal_Int32 i = 1; i <= 25; ++i)
+        {
+            CPPUNIT_ASSERT(xClone->next());
+            CPPUNIT_ASSERT_EQUAL(i, xCloneRow->getInt(1));
+        }
+        CPPUNIT_ASSERT(!xClone->next());
+
+        uno::Reference<lang::XComponent>(xClone, UNO_QUERY_THROW)->dispose();
+        uno::Reference<lang::XComponent>(xRowSet, UNO_QUERY_THROW)->dispose();
+    }
+
+    // Once the row set has read past the first FetchSize window, the first rows
+    // are gone, so a new clone is refused instead of handing out empty rows.
+    {
+        uno::Reference<XRowSet> xRowSet = createForwardOnlyRowSet(xConnection);
+        uno::Reference<XRow> xRow(xRowSet, UNO_QUERY_THROW);
+        for (sal_Int32 i = 1; i <= 15; ++i)
+        {
+            CPPUNIT_ASSERT(xRowSet->next());
+            CPPUNIT_ASSERT_EQUAL(i, xRow->getInt(1));
+        }
+
+        uno::Reference<XResultSetAccess> xAccess(xRowSet, UNO_QUERY_THROW);
+        CPPUNIT_ASSERT_THROW(xAccess->createResultSet(), SQLException);
+
+        // the row set itself carries on
+        for (sal_Int32 i = 16; i <= 25; ++i)
+        {
+            CPPUNIT_ASSERT(xRowSet->next());
+            CPPUNIT_ASSERT_EQUAL(i, xRow->getInt(1));
+        }
+        CPPUNIT_ASSERT(!xRowSet->next());
+
+        uno::Reference<lang::XComponent>(xRowSet, UNO_QUERY_THROW)->dispose();
+    }
+
+    closeDocument(uno::Reference<lang::XComponent>(xDocument, uno::UNO_QUERY));
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(FirebirdTest);
 
 CPPUNIT_PLUGIN_IMPLEMENT();
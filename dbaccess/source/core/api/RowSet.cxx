@@ -1700,6 +1700,8 @@ Reference< XResultSet > ORowSet::impl_prepareAndExecute_throw()
         m_nPrivileges = Privilege::SELECT;
         m_pCache->m_nPrivileges = Privilege::SELECT;
     }
+    if ( m_nResultSetType == ResultSetType::FORWARD_ONLY )
+        m_pCache->setForwardOnly();
     m_pCache->setFetchSize(m_nFetchSize);
     m_aCurrentRow   = m_pCache->createIterator(this);
     m_bIsInsertRow  = false;
@@ -2070,6 +2072,10 @@ Reference< XResultSet > SAL_CALL ORowSet::createResultSet(  )
 
     if(m_xStatement.is())
     {
+        // a clone starts in front of the first row, which a forward only rowset may have dropped already
+        if ( m_pCache && m_pCache->hasReleasedRows() )
+            ::dbtools::throwSQLException( DBA_RES( RID_STR_INVALID_CURSOR_STATE ), StandardSQLState::FUNCTION_SEQUENCE_ERROR, *this );
+
         rtl::Reference<ORowSetClone> pClone = new ORowSetClone( m_aContext, *this, m_pMutex );
         m_aClones.emplace_back(css::uno::Reference< css::uno::XWeak >(pClone));
         return pClone;
@@ -96,6 +96,7 @@ ORowSetCache::ORowSetCache(const Reference< XResultSet >& _xRs,
     ,m_bAfterLast( false )
     ,m_bModified(_bModified)
     ,m_bNew(_bNew)
+    ,m_bForwardOnly(false)
 {
 
     // first try if the result can be used to do inserts and updates
@@ -843,7 +844,8 @@ void ORowSetCache::moveWindow()
         return;
     }
 
-    sal_Int32 nDiff = (m_nFetchSize - 1) / 2;
+    // a forward only cursor never comes back, so use the whole window to read ahead
+    sal_Int32 nDiff = m_bForwardOnly ? 0 : (m_nFetchSize - 1) / 2;
     sal_Int32 nNewStartPos  = (m_nPosition - nDiff) - 1; //m_nPosition is 1-based, but m_nStartPos is 0-based
     sal_Int32 nNewEndPos    = nNewStartPos + m_nFetchSize;
 
@@ -1051,6 +1053,12 @@ void ORowSetCache::moveWindow()
 
     if(!m_bRowCountFinal)
        m_nRowCount = std::max(m_nPosition,m_nRowCount);
+    if ( m_bForwardOnly && m_aCacheIterators.size() == 1 )
+    {
+        // the rows in front of the window will never be visited again, don't let the snapshot keep them
+        if ( OStaticSet* pStaticSet = dynamic_cast<OStaticSet*>(m_xCacheSet.get()) )
+            pStaticSet->releaseRowsBefore(m_nStartPos + 1);
+    }
     OSL_ENSURE(m_nStartPos >= 0,"ORowSetCache::moveWindow: m_nStartPos is less than 0!");
     OSL_ENSURE(m_nEndPos > m_nStartPos,"ORowSetCache::moveWindow: m_nStartPos not smaller than m_nEndPos");
     OSL_ENSURE(m_nEndPos-m_nStartPos <= m_nFetchSize,"ORowSetCache::moveWindow: m_nStartPos and m_nEndPos too far apart");
@@ -1407,6 +1415,12 @@ void ORowSetCache::moveToInsertRow(  )
     }
 }
 
+bool ORowSetCache::hasReleasedRows() const
+{
+    const OStaticSet* pStaticSet = dynamic_cast<const OStaticSet*>(m_xCacheSet.get());
+    return pStaticSet && pStaticSet->hasReleasedRows();
+}
+
 ORowSetCacheIterator ORowSetCache::createIterator(ORowSetBase* _pRowSet)
 {
     ORowSetCacheIterator_Helper aHelper;
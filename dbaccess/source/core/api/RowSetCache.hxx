@@ -75,6 +75,7 @@ namespace dbaccess
         bool                    m_bAfterLast ;
         bool&                   m_bModified ;           // points to the rowset member m_bModified
         bool&                   m_bNew ;                // points to the rowset member m_bNew
+        bool                    m_bForwardOnly ;        // the rowset never moves back
 
         bool fill(ORowSetMatrix::iterator& _aIter, const ORowSetMatrix::const_iterator& _aEnd, sal_Int32& _nPos, bool _bCheck);
         bool reFillMatrix(sal_Int32 _nNewStartPos,sal_Int32 nNewEndPos);
@@ -129,6 +130,10 @@ namespace dbaccess
         void deleteIterator(const ORowSetBase* _pRowSet);
         // sets the size of the matrix
         void setFetchSize(sal_Int32 _nSize);
+        // called from a FORWARD_ONLY rowset: the window only reads ahead and rows left behind may be dropped
+        void setForwardOnly() { m_bForwardOnly = true; }
+        // true if a forward only rowset already dropped rows, a new clone could not visit them
+        bool hasReleasedRows() const;
 
         TORowSetOldRowHelperRef registerOldRow();
         void deregisterOldRow(const TORowSetOldRowHelperRef& _rRow);
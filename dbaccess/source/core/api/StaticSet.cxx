@@ -26,6 +26,8 @@
 #include <o3tl/safeint.hxx>
 #include <osl/diagnose.h>
 
+#include <algorithm>
+
 using namespace dbaccess;
 using namespace connectivity;
 using namespace ::com::sun::star::uno;
@@ -105,6 +107,13 @@ void OStaticSet::fillAllRows()
     m_bEnd = true;
 }
 
+void OStaticSet::releaseRowsBefore(sal_Int32 _nRow)
+{
+    const sal_Int32 nEnd = std::min(_nRow, static_cast<sal_Int32>(m_aSet.size()));
+    for (; m_nReleasedRows + 1 < nEnd; ++m_nReleasedRows)
+        m_aSet[m_nReleasedRows + 1].clear();
+}
+
 // XResultSet
 bool OStaticSet::next()
 {
@@ -273,6 +282,7 @@ void OStaticSet::reset(const Reference< XResultSet> &_xDriverSet)
     OCacheSet::construct(_xDriverSet, m_sRowSetFilter);
     ORowSetMatrix().swap(m_aSet);
     m_aSetIter = m_aSet.end();
+    m_nReleasedRows = 0;
     m_bEnd = false;
     m_aSet.emplace_back(nullptr); // this is the beforefirst record
 }
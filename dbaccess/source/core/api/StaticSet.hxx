@@ -29,12 +29,14 @@ namespace dbaccess
     {
         ORowSetMatrix           m_aSet;
         ORowSetMatrix::iterator m_aSetIter;
+        sal_Int32               m_nReleasedRows;    // rows [1;m_nReleasedRows] lost their data
         bool                    m_bEnd;
         bool fetchRow();
         void fillAllRows();
     public:
         explicit OStaticSet(sal_Int32 i_nMaxRows) : OCacheSet(i_nMaxRows)
             , m_aSetIter(m_aSet.end())
+            , m_nReleasedRows(0)
             , m_bEnd(false)
         {
             m_aSet.push_back(nullptr); // this is the beforefirst record
@@ -50,6 +52,14 @@ namespace dbaccess
         virtual bool hasOrderedBookmarks(  ) override;
         virtual sal_Int32 hashBookmark( const css::uno::Any& bookmark ) override;
 
+        /** drops the data of all rows in front of _nRow
+
+            Only valid for cursors which never move back: the positions stay,
+            but a released row is handed out as null afterwards.
+        */
+        void releaseRowsBefore(sal_Int32 _nRow);
+        bool hasReleasedRows() const { return m_nReleasedRows > 0; }
+
         bool isBeforeFirst(  );
         bool isAfterLast(  );
 
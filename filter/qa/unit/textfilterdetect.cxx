@@ -11,6 +11,8 @@
 #include <unotest/macros_test.hxx>
 
 #include <com/sun/star/document/XExtendedFilterDetection.hpp>
+#include <com/sun/star/document/XTypeDetection.hpp>
+#include <com/sun/star/frame/XStorable.hpp>
 #include <com/sun/star/frame/Desktop.hpp>
 #include <com/sun/star/lang/XServiceInfo.hpp>
 #include <com/sun/star/drawing/XDrawPagesSupplier.hpp>
@@ -22,6 +24,7 @@
 #include <sfx2/docfac.hxx>
 #include <unotools/mediadescriptor.hxx>
 #include <unotools/streamwrap.hxx>
+#include <unotools/tempfile.hxx>
 #include <tools/stream.hxx>
 
 namespace com::sun::star::io
@@ -192,6 +195,44 @@ CPPUNIT_TEST_FIXTURE(TextFilterDetectTest, testEmptyFile)
     }
     xComponent->dispose();
 }
+
+CPPUNIT_TEST_FIXTURE(TextFilterDetectTest, testSignatureWithoutExtension)
+{
+    uno::Reference<document::XTypeDetection> xDetection(
+        getMultiServiceFactory()->createInstance("com.sun.star.document.TypeDetection"),
+        uno::UNO_QUERY_THROW);
+    auto detect = [&xDetection](const OUString& rURL) {
+        uno::Sequence<beans::PropertyValue> aDescriptor
+            = { comphelper::makePropertyValue("URL", rURL) };
+        return xDetection->queryTypeByDescriptor(aDescriptor, true);
+    };
+
+    auto xComponent = loadFromDesktop("private:factory/swriter");
+    uno::Reference<frame::XStorable> xStorable(xComponent, uno::UNO_QUERY_THROW);
+
+    // A zip package, an OLE2 compound file and a PDF: given a file without a usable
+    // extension, detection has to find the same type as with the right extension.
+    const std::pair<OUString, OUString> aFormats[]
+        = { { "writer8", ".odt" }, { "MS Word 97", ".doc" }, { "writer_pdf_Export", ".pdf" } };
+    for (const auto& [rFilter, rExtension] : aFormats)
+    {
+        utl::TempFile aWithExtension(u"detect", true, &rExtension);
+        aWithExtension.EnableKillingFile();
+        utl::TempFile aWithoutExtension;
+        aWithoutExtension.EnableKillingFile();
+
+        uno::Sequence<beans::PropertyValue> aStoreArgs
+            = { comphelper::makePropertyValue("FilterName", rFilter) };
+        xStorable->storeToURL(aWithExtension.GetURL(), aStoreArgs);
+        xStorable->storeToURL(aWithoutExtension.GetURL(), aStoreArgs);
+
+        OUString aExpected = detect(aWithExtension.GetURL());
+        CPPUNIT_ASSERT_MESSAGE(rFilter.toUtf8().getStr(), !aExpected.isEmpty());
+        CPPUNIT_ASSERT_EQUAL(aExpected, detect(aWithoutExtension.GetURL()));
+    }
+
+    xComponent->dispose();
+}
 }
 
 CPPUNIT_PLUGIN_IMPLEMENT();
@@ -36,6 +36,8 @@
 #include <tools/urlobj.hxx>
 #include <comphelper/fileurl.hxx>
 #include <comphelper/sequence.hxx>
+#include <algorithm>
+#include <cstring>
 #include <utility>
 
 #define DEBUG_TYPE_DETECTION 0
@@ -353,6 +355,113 @@ public:
     }
 };
 
+/**
+ * Leading bytes of common container and document formats, and the types
+ * that are expected to start with them.  This is only used to decide
+ * which types to try first; the detect services still do the real work.
+ */
+struct TypeSignature
+{
+    const char* pType;
+    const char* pMagic;
+    sal_Int32 nMagicLen;
+};
+
+const TypeSignature aTypeSignatures[] = {
+    // Zip container (ODF, OOXML, UOF, StarOffice XML)
+    { "writer8_template", "PK\x03\x04", 4 },
+    { "writer8", "PK\x03\x04", 4 },
+    { "calc8_template", "PK\x03\x04", 4 },
+    { "calc8", "PK\x03\x04", 4 },
+    { "impress8_template", "PK\x03\x04", 4 },
+    { "impress8", "PK\x03\x04", 4 },
+    { "draw8_template", "PK\x03\x04", 4 },
+    { "draw8", "PK\x03\x04", 4 },
+    { "chart8", "PK\x03\x04", 4 },
+    { "math8", "PK\x03\x04", 4 },
+    { "writerglobal8_template", "PK\x03\x04", 4 },
+    { "writerglobal8", "PK\x03\x04", 4 },
+    { "writerweb8_writer_template", "PK\x03\x04", 4 },
+    { "StarBase", "PK\x03\x04", 4 },
+    { "writer_OOXML_Text_Template", "PK\x03\x04", 4 },
+    { "writer_OOXML", "PK\x03\x04", 4 },
+    { "writer_MS_Word_2007_Template", "PK\x03\x04", 4 },
+    { "writer_MS_Word_2007", "PK\x03\x04", 4 },
+    { "Office Open XML Spreadsheet Template", "PK\x03\x04", 4 },
+    { "Office Open XML Spreadsheet", "PK\x03\x04", 4 },
+    { "MS Excel 2007 XML Template", "PK\x03\x04", 4 },
+    { "MS Excel 2007 XML", "PK\x03\x04", 4 },
+    { "MS Excel 2007 Binary", "PK\x03\x04", 4 },
+    { "MS PowerPoint 2007 XML Template", "PK\x03\x04", 4 },
+    { "MS PowerPoint 2007 XML AutoPlay", "PK\x03\x04", 4 },
+    { "MS PowerPoint 2007 XML", "PK\x03\x04", 4 },
+    { "Unified_Office_Format_text", "PK\x03\x04", 4 },
+    { "Unified_Office_Format_spreadsheet", "PK\x03\x04", 4 },
+    { "Unified_Office_Format_presentation", "PK\x03\x04", 4 },
+    { "calc_StarOffice_XML_Calc", "PK\x03\x04", 4 },
+    { "calc_StarOffice_XML_Calc_Template", "PK\x03\x04", 4 },
+    { "chart_StarOffice_XML_Chart", "PK\x03\x04", 4 },
+    { "draw_StarOffice_XML_Draw", "PK\x03\x04", 4 },
+    { "draw_StarOffice_XML_Draw_Template", "PK\x03\x04", 4 },
+    { "impress_StarOffice_XML_Impress", "PK\x03\x04", 4 },
+    { "impress_StarOffice_XML_Impress_Template", "PK\x03\x04", 4 },
+    { "math_StarOffice_XML_Math", "PK\x03\x04", 4 },
+    { "writer_StarOffice_XML_Writer", "PK\x03\x04", 4 },
+    { "writer_StarOffice_XML_Writer_Template", "PK\x03\x04", 4 },
+    { "writer_globaldocument_StarOffice_XML_Writer_GlobalDocument", "PK\x03\x04", 4 },
+    { "writer_web_StarOffice_XML_Writer_Web_Template", "PK\x03\x04", 4 },
+
+    // OLE2 compound document (MS binary formats, encrypted OOXML)
+    { "writer_MS_Word_97_Vorlage", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "writer_MS_Word_97", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "writer_MS_Word_95_Vorlage", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "writer_MS_Word_95", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "writer_MS_WinWord_60", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "writer_MS_Works_Document", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "calc_MS_Excel_97_VorlageTemplate", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "calc_MS_Excel_97", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "calc_MS_Excel_95_VorlageTemplate", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "calc_MS_Excel_95", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "calc_MS_Excel_5095_VorlageTemplate", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "calc_MS_Excel_5095", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "impress_MS_PowerPoint_97_Vorlage", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "impress_MS_PowerPoint_97_AutoPlay", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "impress_MS_PowerPoint_97", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "draw_Visio_Document", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "draw_Publisher_Document", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "writer_MS_Word_2007", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "MS Excel 2007 XML", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+    { "MS PowerPoint 2007 XML", "\xD0\xCF\x11\xE0\xA1\xB1\x1A\xE1", 8 },
+
+    // Text based formats with a fixed prefix
+    { "pdf_Portable_Document_Format", "%PDF-", 5 },
+    { "writer_Rich_Text_Format", "{\\rtf", 5 },
+    { "calc_Rich_Text_Format", "{\\rtf", 5 },
+
+    // Images
+    { "png_Portable_Network_Graphic", "\x89PNG\r\n\x1A\n", 8 },
+    { "jpg_JPEG", "\xFF\xD8\xFF", 3 },
+    { "gif_Graphics_Interchange", "GIF8", 4 },
+    { "tif_Tag_Image_File", "II*\0", 4 },
+    { "tif_Tag_Image_File", "MM\0*", 4 },
+    { "bmp_MS_Windows", "BM", 2 },
+};
+
+/// Longest magic in aTypeSignatures, i.e. how much has to be read from the stream.
+constexpr sal_Int32 nTypeSignatureHeaderLen = 8;
+
+bool matchesTypeSignature(std::u16string_view rType, const css::uno::Sequence<sal_Int8>& rHeader)
+{
+    for (const TypeSignature& rSignature : aTypeSignatures)
+    {
+        if (rSignature.nMagicLen > rHeader.getLength() || !o3tl::equalsAscii(rType, rSignature.pType))
+            continue;
+        if (memcmp(rHeader.getConstArray(), rSignature.pMagic, rSignature.nMagicLen) == 0)
+            return true;
+    }
+    return false;
+}
+
 #if DEBUG_TYPE_DETECTION
 void printFlatDetectionList(const char* caption, const FlatDetection& types)
 {
@@ -415,6 +524,11 @@ OUString SAL_CALL TypeDetection::queryTypeByDescriptor(css::uno::Sequence< css::
         auto last = std::unique(lFlatTypes.begin(), lFlatTypes.end(), EqualByType());
         lFlatTypes.erase(last, lFlatTypes.end());
 
+        // A pattern match on the first type suppresses deep detection
+        // anyway, so only sniff the content when it will be looked at.
+        if (bAllowDeep && !lFlatTypes.empty() && !lFlatTypes.front().bMatchByPattern)
+            impl_prioritizeBySignature(stlDescriptor, lFlatTypes);
+
         OUString sLastChance;
 
         // verify every flat detected (or preselected!) type
@@ -853,6 +967,48 @@ void TypeDetection::impl_getAllFormatTypes(
 }
 
 
+void TypeDetection::impl_prioritizeBySignature(
+    utl::MediaDescriptor& rDescriptor, FlatDetection& rFlatTypes)
+{
+    // Types matched by pattern or extension keep their precedence; only the
+    // types that would otherwise be tried in plain rank order are reordered.
+    auto itFirst = std::find_if(rFlatTypes.begin(), rFlatTypes.end(),
+        [](const FlatDetectionInfo& rInfo)
+        { return !rInfo.bMatchByPattern && !rInfo.bMatchByExtension; });
+    if (itFirst == rFlatTypes.end())
+        return;
+
+    // The deep detection needs the stream anyway. Like there, a failure to
+    // open it ends the whole detection.
+    impl_openStream(rDescriptor);
+    css::uno::Reference<css::io::XInputStream> xStream = rDescriptor.getUnpackedValueOrDefault(
+        utl::MediaDescriptor::PROP_INPUTSTREAM, css::uno::Reference<css::io::XInputStream>());
+    css::uno::Reference<css::io::XSeekable> xSeek(xStream, css::uno::UNO_QUERY);
+    if (!xSeek.is())
+        return;
+
+    css::uno::Sequence<sal_Int8> aHeader;
+    try
+    {
+        xSeek->seek(0);
+        xStream->readBytes(aHeader, nTypeSignatureHeaderLen);
+        xSeek->seek(0);
+    }
+    catch (const css::uno::RuntimeException&)
+    {
+        throw;
+    }
+    catch (const css::uno::Exception&)
+    {
+        return;
+    }
+
+    std::stable_partition(itFirst, rFlatTypes.end(),
+        [&aHeader](const FlatDetectionInfo& rInfo)
+        { return matchesTypeSignature(rInfo.sType, aHeader); });
+}
+
+
 OUString TypeDetection::impl_detectTypeFlatAndDeep(      utl::MediaDescriptor& rDescriptor   ,
                                                           const FlatDetection&                 lFlatTypes    ,
                                                                 bool                       bAllowDeep    ,
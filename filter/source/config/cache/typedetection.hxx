@@ -85,6 +85,15 @@ private:
         const css::util::URL& aParsedURL, utl::MediaDescriptor const & rDescriptor,
         FlatDetection& rFlatTypes);
 
+    /**
+     * Peek at the first bytes of the stream and move the types whose
+     * well-known signature matches to the front of the candidates that
+     * were not matched by pattern or extension.  Nothing is removed, so
+     * the deep detection services still have the final say.
+     */
+    void impl_prioritizeBySignature(
+        utl::MediaDescriptor& rDescriptor, FlatDetection& rFlatTypes);
+
 
     /** @short      make a combined flat/deep type detection
 
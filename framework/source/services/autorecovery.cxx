@@ -3015,6 +3015,11 @@ void AutoRecovery::implts_saveOneDoc(const OUString&
 
     lNewArgs[utl::MediaDescriptor::PROP_AUTOSAVEEVENT] <<= true;
 
+    // The backup is only ever loaded again by the recovery dialog, which never shows
+    // its preview. Rendering the first page for the thumbnail is a large part of the
+    // time a big document spends in an autosave, so skip it.
+    lNewArgs["NoThumbnail"] <<= true;
+
     // try to save this document as a new temp file every time.
     // Mark AutoSave state as "INCOMPLETE" if it failed.
     // Because the last temp file is too old and does not include all changes.
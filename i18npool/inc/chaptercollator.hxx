@@ -38,6 +38,8 @@ public:
     sal_Int32 SAL_CALL compareSubstring( const OUString& s1, sal_Int32 off1, sal_Int32 len1,
         const OUString& s2, sal_Int32 off2, sal_Int32 len2) override;
     sal_Int32 SAL_CALL compareString( const OUString& s1, const OUString& s2) override;
+    // chapter numbers are compared by value, which plain sort keys can't express
+    css::uno::Sequence< sal_Int8 > SAL_CALL getSortKey( const OUString& ) override { return css::uno::Sequence< sal_Int8 >(); }
 
     //XServiceInfo
     virtual OUString SAL_CALL getImplementationName() override;
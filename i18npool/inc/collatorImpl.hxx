@@ -19,7 +19,7 @@
 #pragma once
 
 #include <com/sun/star/uno/Reference.h>
-#include <com/sun/star/i18n/XCollator.hpp>
+#include <com/sun/star/i18n/XExtendedCollator.hpp>
 #include <com/sun/star/lang/Locale.hpp>
 #include <cppuhelper/implbase.hxx>
 #include <com/sun/star/lang/XServiceInfo.hpp>
@@ -38,7 +38,7 @@ namespace i18npool {
 //      ----------------------------------------------------
 class CollatorImpl : public cppu::WeakImplHelper
 <
-    css::i18n::XCollator,
+    css::i18n::XExtendedCollator,
     css::lang::XServiceInfo
 >
 {
@@ -67,6 +67,9 @@ public:
 
     virtual css::uno::Sequence< sal_Int32 > SAL_CALL listCollatorOptions( const OUString& collatorAlgorithmName ) override;
 
+    // XExtendedCollator
+    virtual css::uno::Sequence< sal_Int8 > SAL_CALL getSortKey( const OUString& rStr ) override;
+
     //XServiceInfo
     virtual OUString SAL_CALL getImplementationName() override;
     virtual sal_Bool SAL_CALL supportsService(const OUString& ServiceName) override;
@@ -80,8 +83,9 @@ private:
         OUString algorithm;
         OUString service;
         css::uno::Reference < XCollator > xC;
+        css::uno::Reference < XExtendedCollator > xEC; // may be null if sort keys are not supported
         lookupTableItem(css::lang::Locale _aLocale, OUString _algorithm, OUString _service,
-                        css::uno::Reference < XCollator > _xC) : aLocale(std::move(_aLocale)), algorithm(std::move(_algorithm)), service(std::move(_service)), xC(std::move(_xC)) {}
+                        css::uno::Reference < XCollator > _xC) : aLocale(std::move(_aLocale)), algorithm(std::move(_algorithm)), service(std::move(_service)), xC(std::move(_xC)), xEC(xC, css::uno::UNO_QUERY) {}
         bool equals(const css::lang::Locale& rLocale, std::u16string_view _algorithm) {
         return aLocale.Language == rLocale.Language &&
             aLocale.Country == rLocale.Country &&
@@ -18,7 +18,7 @@
  */
 #pragma once
 
-#include <com/sun/star/i18n/XCollator.hpp>
+#include <com/sun/star/i18n/XExtendedCollator.hpp>
 #include <com/sun/star/lang/XServiceInfo.hpp>
 #include <cppuhelper/implbase.hxx>
 #include <osl/module.h>
@@ -31,7 +31,7 @@
 
 namespace i18npool {
 
-class Collator_Unicode final : public cppu::WeakImplHelper < css::i18n::XCollator, css::lang::XServiceInfo >
+class Collator_Unicode final : public cppu::WeakImplHelper < css::i18n::XExtendedCollator, css::lang::XServiceInfo >
 {
 public:
     // Constructors
@@ -47,6 +47,8 @@ public:
     sal_Int32 SAL_CALL loadCollatorAlgorithm( const OUString& impl, const css::lang::Locale& rLocale,
         sal_Int32 collatorOptions) override;
 
+    // XExtendedCollator
+    css::uno::Sequence< sal_Int8 > SAL_CALL getSortKey( const OUString& rStr ) override;
 
     // following 4 methods are implemented in collatorImpl.
     sal_Int32 SAL_CALL loadDefaultCollator( const css::lang::Locale&,  sal_Int32) override {throw css::uno::RuntimeException();}
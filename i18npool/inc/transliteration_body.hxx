@@ -52,6 +52,11 @@ public:
 
 protected:
     MappingType nMappingType;
+
+    /// Whether ASCII characters are mapped by plain ASCII case conversion,
+    /// i.e. the mapping type is a case mapping or folding and the locale
+    /// has no special casing rules for them.
+    bool hasAsciiCaseMapping() const;
 };
 
 class Transliteration_u2l final : public Transliteration_body
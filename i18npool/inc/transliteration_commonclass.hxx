@@ -93,6 +93,19 @@ protected:
         virtual OUString
         foldingImpl( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount, css::uno::Sequence< sal_Int32 >* pOffset ) = 0;
 
+        /// Whether all nCount characters at pStr are 7-bit ASCII, written so
+        /// that the compiler can vectorize it.
+        static bool isAscii( const sal_Unicode* pStr, sal_Int32 nCount )
+        {
+            sal_Unicode nBits = 0;
+            for (sal_Int32 i = 0; i < nCount; ++i)
+                nBits |= pStr[i];
+            return nBits < 0x80;
+        }
+
+        /// Offsets of a transliteration that maps each character to one character.
+        static css::uno::Sequence< sal_Int32 > identityOffsets( sal_Int32 startPos, sal_Int32 nCount );
+
         css::lang::Locale   aLocale;
         const char*         transliterationName;
         const char*         implementationName;
@@ -21,10 +21,12 @@ public:
 
     void testTitleCase();
     void testStringType();
+    void testAsciiCaseMapping();
 
     CPPUNIT_TEST_SUITE(TestCharacterClassification);
     CPPUNIT_TEST(testTitleCase);
     CPPUNIT_TEST(testStringType);
+    CPPUNIT_TEST(testAsciiCaseMapping);
     CPPUNIT_TEST_SUITE_END();
 private:
     uno::Reference<i18n::XCharacterClassification> m_xCC;
@@ -65,6 +67,29 @@ void TestCharacterClassification::testTitleCase()
     }
 }
 
+void TestCharacterClassification::testAsciiCaseMapping()
+{
+    lang::Locale aLocale;
+    aLocale.Language = "en";
+    aLocale.Country = "US";
+
+    {
+        // a substring, ASCII only
+        OUString sTest("xIndex-42 Qy");
+        CPPUNIT_ASSERT_EQUAL(OUString("INDEX-42 Q"), m_xCC->toUpper(sTest, 1, 10, aLocale));
+        CPPUNIT_ASSERT_EQUAL(OUString("index-42 q"), m_xCC->toLower(sTest, 1, 10, aLocale));
+    }
+
+    {
+        // Turkish maps I and i differently, so must not take the ASCII path
+        aLocale.Language = "tr";
+        aLocale.Country = "TR";
+        OUString sTest("Ii");
+        CPPUNIT_ASSERT_EQUAL(OUString(u"I\u0130"), m_xCC->toUpper(sTest, 0, sTest.getLength(), aLocale));
+        CPPUNIT_ASSERT_EQUAL(OUString(u"\u0131i"), m_xCC->toLower(sTest, 0, sTest.getLength(), aLocale));
+    }
+}
+
 //https://bugs.libreoffice.org/show_bug.cgi?id=69641
 void TestCharacterClassification::testStringType()
 {
@@ -38,12 +38,14 @@ public:
     void testSearches();
     void testWildcardSearch();
     void testApostropheSearch();
+    void testRepeatedSearch();
 
     CPPUNIT_TEST_SUITE(TestTextSearch);
     CPPUNIT_TEST(testICU);
     CPPUNIT_TEST(testSearches);
     CPPUNIT_TEST(testWildcardSearch);
     CPPUNIT_TEST(testApostropheSearch);
+    CPPUNIT_TEST(testRepeatedSearch);
     CPPUNIT_TEST_SUITE_END();
 private:
     uno::Reference<util::XTextSearch> m_xSearch;
@@ -402,6 +404,49 @@ void TestTextSearch::testApostropheSearch()
     CPPUNIT_ASSERT( aRes.subRegExpressions > 0 );
 }
 
+void TestTextSearch::testRepeatedSearch()
+{
+    OUString str( "Ab ab AB" );
+
+    util::SearchOptions aOptions;
+    aOptions.algorithmType = util::SearchAlgorithms_ABSOLUTE;
+    aOptions.transliterateFlags = static_cast<int>(TransliterationFlags::IGNORE_CASE
+                                | TransliterationFlags::IGNORE_WIDTH);
+    aOptions.searchString = "ab";
+    m_xSearch->setOptions( aOptions );
+
+    util::SearchResult aRes;
+
+    // searching the same text twice reuses the folded text
+    for (int i = 0; i < 2; ++i)
+    {
+        aRes = m_xSearch->searchForward( str, 0, str.getLength() );
+        CPPUNIT_ASSERT( aRes.subRegExpressions > 0 );
+        CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(0), aRes.startOffset[0] );
+        CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(2), aRes.endOffset[0] );
+    }
+
+    // a different range has to be folded again
+    aRes = m_xSearch->searchForward( str, 1, str.getLength() );
+    CPPUNIT_ASSERT( aRes.subRegExpressions > 0 );
+    CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(3), aRes.startOffset[0] );
+    CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(5), aRes.endOffset[0] );
+
+    // so has a different text of the same length
+    aRes = m_xSearch->searchForward( "Xb ab AB", 0, str.getLength() );
+    CPPUNIT_ASSERT( aRes.subRegExpressions > 0 );
+    CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(3), aRes.startOffset[0] );
+    CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(5), aRes.endOffset[0] );
+
+    // and new options drop the folded text
+    aOptions.transliterateFlags = 0;
+    m_xSearch->setOptions( aOptions );
+    aRes = m_xSearch->searchBackward( str, str.getLength(), 0 );
+    CPPUNIT_ASSERT( aRes.subRegExpressions > 0 );
+    CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(5), aRes.startOffset[0] );
+    CPPUNIT_ASSERT_EQUAL( static_cast<sal_Int32>(3), aRes.endOffset[0] );
+}
+
 void TestTextSearch::setUp()
 {
     BootstrapFixtureBase::setUp();
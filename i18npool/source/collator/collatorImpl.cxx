@@ -134,6 +134,17 @@ CollatorImpl::listCollatorOptions( const OUString& /*collatorAlgorithmName*/ )
     return option_int;
 }
 
+Sequence< sal_Int8 > SAL_CALL
+CollatorImpl::getSortKey( const OUString& rStr )
+{
+    if (cachedItem && cachedItem->xEC.is())
+        return cachedItem->xEC->getSortKey(rStr);
+
+    // Without a collator compareString() falls back to comparing code units,
+    // which has no sort key representation here; let the caller compare.
+    return Sequence< sal_Int8 >();
+}
+
 bool
 CollatorImpl::createCollator(const lang::Locale& rLocale, const OUString& serviceName, const OUString& rSortAlgorithm)
 {
@@ -131,6 +131,27 @@ Collator_Unicode::compareString( const OUString& str1, const OUString& str2)
                              reinterpret_cast<const UChar *>(str2.getStr()), str2.getLength());
 }
 
+Sequence< sal_Int8 > SAL_CALL
+Collator_Unicode::getSortKey( const OUString& rStr )
+{
+    const UChar* pStr = reinterpret_cast<const UChar *>(rStr.getStr());
+    // Most keys are at most a few bytes longer than the UTF-16 input, so try
+    // with a buffer of that size first and only ask again if it was too small.
+    Sequence< sal_Int8 > aKey( 2 * rStr.getLength() + 16 );
+    int32_t nLen = collator->getSortKey(pStr, rStr.getLength(),
+                                        reinterpret_cast<uint8_t *>(aKey.getArray()), aKey.getLength());
+    if (nLen > aKey.getLength())
+    {
+        aKey.realloc(nLen);
+        nLen = collator->getSortKey(pStr, rStr.getLength(),
+                                    reinterpret_cast<uint8_t *>(aKey.getArray()), aKey.getLength());
+    }
+    // Keep the terminating 0 byte, so that even the key of an empty string
+    // is not empty and a key never is a strict prefix of another one.
+    aKey.realloc(nLen);
+    return aKey;
+}
+
 #ifndef DISABLE_DYNLOADING
 
 extern "C" { static void thisModule() {} }
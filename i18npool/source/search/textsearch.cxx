@@ -124,6 +124,8 @@ void TextSearch::setOptions2( const SearchOptions2& rOptions )
     pWLD.reset();
     pJumpTable.reset();
     pJumpTable2.reset();
+    maFolded = FoldedText();
+    maFolded2 = FoldedText();
     maWildcardReversePattern.clear();
     maWildcardReversePattern2.clear();
     TransliterationFlags transliterateFlags = static_cast<TransliterationFlags>(aSrchPara.transliterateFlags);
@@ -305,6 +307,24 @@ static sal_Int32 FindPosInSeq_Impl( const Sequence <sal_Int32>& rOff, sal_Int32
     return static_cast<sal_Int32>(std::distance(rOff.begin(), pOff));
 }
 
+OUString TextSearch::foldText( FoldedText& rFolded,
+        const Reference< XExtendedTransliteration >& rTranslit,
+        const OUString& rStr, sal_Int32 nStartPos, sal_Int32 nCount,
+        Sequence< sal_Int32 >& rOffsets )
+{
+    if (rFolded.nStartPos != nStartPos || rFolded.nCount != nCount || rFolded.aInput != rStr)
+    {
+        Sequence< sal_Int32 > aOffsets( nCount );
+        rFolded.aOutput = rTranslit->transliterate( rStr, nStartPos, nCount, aOffsets );
+        rFolded.aOffsets = aOffsets;
+        rFolded.aInput = rStr;
+        rFolded.nStartPos = nStartPos;
+        rFolded.nCount = nCount;
+    }
+    rOffsets = rFolded.aOffsets;
+    return rFolded.aOutput;
+}
+
 bool TextSearch::isCellStart(const OUString& searchStr, sal_Int32 nPos)
 {
     sal_Int32 nDone;
@@ -350,8 +370,8 @@ SearchResult TextSearch::searchForward( const OUString& searchStr, sal_Int32 sta
             nInEndPos += std::min(nMaxTrailingLen, searchStr.getLength() - endPos);
         }
 
-        css::uno::Sequence<sal_Int32> offset(nInEndPos - nInStartPos);
-        in_str = xTranslit->transliterate(searchStr, nInStartPos, nInEndPos - nInStartPos, offset);
+        css::uno::Sequence<sal_Int32> offset;
+        in_str = foldText(maFolded, xTranslit, searchStr, nInStartPos, nInEndPos - nInStartPos, offset);
 
         if ( bReplaceApostrophe )
             in_str = in_str.replace(u'\u2019', '\'');
@@ -409,10 +429,8 @@ SearchResult TextSearch::searchForward( const OUString& searchStr, sal_Int32 sta
     {
         SearchResult sres2;
 
-        in_str = searchStr;
-        css::uno::Sequence <sal_Int32> offset( in_str.getLength());
-
-        in_str = xTranslit2->transliterate( searchStr, 0, in_str.getLength(), offset );
+        css::uno::Sequence <sal_Int32> offset;
+        in_str = foldText(maFolded2, xTranslit2, searchStr, 0, searchStr.getLength(), offset);
 
         if( startPos )
             startPos = FindPosInSeq_Impl( offset, startPos );
@@ -468,8 +486,8 @@ SearchResult TextSearch::searchBackward( const OUString& searchStr, sal_Int32 st
     if ( xTranslit.is() )
     {
         // apply only simple 1<->1 transliteration here
-        css::uno::Sequence<sal_Int32> offset(startPos - endPos);
-        in_str = xTranslit->transliterate( searchStr, endPos, startPos - endPos, offset );
+        css::uno::Sequence<sal_Int32> offset;
+        in_str = foldText(maFolded, xTranslit, searchStr, endPos, startPos - endPos, offset);
 
         if ( bReplaceApostrophe )
             in_str = in_str.replace(u'\u2019', '\'');
@@ -531,10 +549,8 @@ SearchResult TextSearch::searchBackward( const OUString& searchStr, sal_Int32 st
     {
         SearchResult sres2;
 
-        in_str = searchStr;
-        css::uno::Sequence <sal_Int32> offset( in_str.getLength());
-
-        in_str = xTranslit2->transliterate(searchStr, 0, in_str.getLength(), offset);
+        css::uno::Sequence <sal_Int32> offset;
+        in_str = foldText(maFolded2, xTranslit2, searchStr, 0, searchStr.getLength(), offset);
 
         if( startPos < searchStr.getLength() )
             startPos = FindPosInSeq_Impl( offset, startPos );
@@ -692,16 +708,9 @@ void TextSearch::MakeBackwardTab2()
 
 sal_Int32 TextSearch::GetDiff( const sal_Unicode cChr ) const
 {
-    TextSearchJumpTable *pJump;
-    OUString sSearchKey;
-
-    if ( bUsePrimarySrchStr ) {
-        pJump = pJumpTable.get();
-        sSearchKey = sSrchStr;
-    } else {
-        pJump = pJumpTable2.get();
-        sSearchKey = sSrchStr2;
-    }
+    // called for every step of the search loop, so don't copy the key here
+    const TextSearchJumpTable* pJump = bUsePrimarySrchStr ? pJumpTable.get() : pJumpTable2.get();
+    const OUString& sSearchKey = bUsePrimarySrchStr ? sSrchStr : sSrchStr2;
 
     TextSearchJumpTable::const_iterator iLook = pJump->find( cChr );
     if ( iLook == pJump->end() )
@@ -715,7 +724,7 @@ SearchResult TextSearch::NSrchFrwrd( const OUString& searchStr, sal_Int32 startP
     SearchResult aRet;
     aRet.subRegExpressions = 0;
 
-    OUString sSearchKey = bUsePrimarySrchStr ? sSrchStr : sSrchStr2;
+    const OUString& sSearchKey = bUsePrimarySrchStr ? sSrchStr : sSrchStr2;
 
     sal_Int32 nSuchIdx = searchStr.getLength();
     sal_Int32 nEnd = endPos;
@@ -783,7 +792,7 @@ SearchResult TextSearch::NSrchBkwrd( const OUString& searchStr, sal_Int32 startP
     SearchResult aRet;
     aRet.subRegExpressions = 0;
 
-    OUString sSearchKey = bUsePrimarySrchStr ? sSrchStr : sSrchStr2;
+    const OUString& sSearchKey = bUsePrimarySrchStr ? sSrchStr : sSrchStr2;
 
     sal_Int32 nSuchIdx = searchStr.getLength();
     sal_Int32 nEnd = endPos;
@@ -24,9 +24,9 @@
 #include <com/sun/star/util/XTextSearch2.hpp>
 #include <com/sun/star/lang/XServiceInfo.hpp>
 
-#include <map>
 #include <memory>
 #include <mutex>
+#include <unordered_map>
 
 #include <unicode/regex.h>
 #include <unicode/unistr.h>
@@ -39,7 +39,7 @@ namespace com::sun::star::uno { class XComponentContext; }
 
 
 class WLevDistance;
-typedef ::std::map< sal_Unicode, sal_Int32 > TextSearchJumpTable;
+typedef ::std::unordered_map< sal_Unicode, sal_Int32 > TextSearchJumpTable;
 
 class TextSearch: public cppu::WeakImplHelper
 <
@@ -59,6 +59,23 @@ class TextSearch: public cppu::WeakImplHelper
     css::uno::Reference< css::i18n::XExtendedTransliteration > xTranslit;
     css::uno::Reference< css::i18n::XExtendedTransliteration > xTranslit2;
 
+    // The last transliterated text, a repeated search in the same string and
+    // range (e.g. Find followed by Replace) doesn't need to fold it again.
+    struct FoldedText
+    {
+        OUString aInput;
+        sal_Int32 nStartPos = -1;
+        sal_Int32 nCount = -1;
+        OUString aOutput;
+        css::uno::Sequence< sal_Int32 > aOffsets;
+    };
+    FoldedText maFolded;
+    FoldedText maFolded2;
+    static OUString foldText( FoldedText& rFolded,
+        const css::uno::Reference< css::i18n::XExtendedTransliteration >& rTranslit,
+        const OUString& rStr, sal_Int32 nStartPos, sal_Int32 nCount,
+        css::uno::Sequence< sal_Int32 >& rOffsets );
+
     // define a function pointer for the different search methods
     typedef css::util::SearchResult
         (SAL_CALL TextSearch::*FnSrch)( const OUString& searchStr,
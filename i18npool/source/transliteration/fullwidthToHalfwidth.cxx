@@ -46,6 +46,15 @@ fullwidthToHalfwidth::fullwidthToHalfwidth()
 OUString
 fullwidthToHalfwidth::transliterateImpl( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount, Sequence< sal_Int32 >* pOffset )
 {
+    // ASCII is halfwidth already; offsets are relative to startPos, same as
+    // the one to one mapping of the general case returns them
+    if (isAscii(inStr.getStr() + startPos, nCount))
+    {
+        if (pOffset)
+            *pOffset = identityOffsets(0, nCount);
+        return inStr.copy(startPos, nCount);
+    }
+
     // Decomposition: GA --> KA + voice-mark
     const OUString& newStr = i18nutil::widthfolding::decompose_ja_voiced_sound_marks (inStr, startPos, nCount, pOffset);
 
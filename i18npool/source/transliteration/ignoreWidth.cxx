@@ -32,6 +32,15 @@ namespace i18npool {
 OUString
 ignoreWidth::foldingImpl( const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount, Sequence< sal_Int32 >* pOffset )
 {
+    // ASCII is halfwidth already; offsets are relative to startPos, same as
+    // the one to one mapping of the general case returns them
+    if (isAscii(inStr.getStr() + startPos, nCount))
+    {
+        if (pOffset)
+            *pOffset = identityOffsets(0, nCount);
+        return inStr.copy(startPos, nCount);
+    }
+
     rtl::Reference< fullwidthToHalfwidth > t1(new fullwidthToHalfwidth);
     return t1->transliterateImpl(inStr, startPos, nCount, pOffset);
 }
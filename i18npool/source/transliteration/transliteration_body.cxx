@@ -29,10 +29,12 @@
 #include <comphelper/processfactory.hxx>
 #include <comphelper/sequence.hxx>
 #include <o3tl/temporary.hxx>
+#include <rtl/character.hxx>
 
 #include <characterclassificationImpl.hxx>
 
 #include <transliteration_body.hxx>
+#include <algorithm>
 #include <memory>
 #include <numeric>
 
@@ -89,6 +91,16 @@ static MappingType lcl_getMappingTypeForToggleCase( MappingType nMappingType, sa
     return nRes;
 }
 
+bool Transliteration_body::hasAsciiCaseMapping() const
+{
+    if (nMappingType != MappingType::UpperToLower && nMappingType != MappingType::LowerToUpper
+        && nMappingType != (MappingType::LowerToUpper | MappingType::UpperToLower)
+        && nMappingType != MappingType::SimpleFolding && nMappingType != MappingType::FullFolding)
+        return false;
+    // see casefolding::getConditionalValue() for I, i and J
+    return aLocale.Language != "tr" && aLocale.Language != "az" && aLocale.Language != "lt";
+}
+
 OUString
 Transliteration_body::transliterateImpl(
     const OUString& inStr, sal_Int32 startPos, sal_Int32 nCount,
@@ -96,6 +108,28 @@ Transliteration_body::transliterateImpl(
 {
     const sal_Unicode *in = inStr.getStr() + startPos;
 
+    // ASCII maps one to one, without table lookups and without the need to
+    // collect offsets character by character.
+    if (nCount > 0 && hasAsciiCaseMapping() && isAscii(in, nCount))
+    {
+        rtl_uString* pStr = rtl_uString_alloc(nCount);
+        sal_Unicode* out = pStr->buffer;
+        if (nMappingType == MappingType::LowerToUpper)
+            std::transform(in, in + nCount, out, [](sal_Unicode c) {
+                return static_cast<sal_Unicode>(rtl::toAsciiUpperCase(c)); });
+        else if (nMappingType == (MappingType::LowerToUpper | MappingType::UpperToLower))
+            std::transform(in, in + nCount, out, [](sal_Unicode c) {
+                return static_cast<sal_Unicode>(rtl::isAsciiLowerCase(c) ? rtl::toAsciiUpperCase(c)
+                                                                          : rtl::toAsciiLowerCase(c)); });
+        else
+            std::transform(in, in + nCount, out, [](sal_Unicode c) {
+                return static_cast<sal_Unicode>(rtl::toAsciiLowerCase(c)); });
+        out[nCount] = 0;
+        if (pOffset)
+            *pOffset = identityOffsets(startPos, nCount);
+        return OUString(pStr, SAL_NO_ACQUIRE);
+    }
+
     // We could assume that most calls result in identical string lengths,
     // thus using a preallocated OUStringBuffer could be an easy way
     // to assemble the return string without too much hassle. However,
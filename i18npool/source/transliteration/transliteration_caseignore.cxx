@@ -18,6 +18,7 @@
  */
 
 #include <com/sun/star/i18n/TransliterationType.hpp>
+#include <rtl/character.hxx>
 #include <rtl/ref.hxx>
 
 #include <i18nutil/casefolding.hxx>
@@ -120,9 +121,22 @@ Transliteration_caseignore::compare(
 #define NOT_END_OF_STR1 (nMatch1 < nCount1 || e1.current < e1.element.nmap)
 #define NOT_END_OF_STR2 (nMatch2 < nCount2 || e2.current < e2.element.nmap)
 
+    // Pairs of ASCII characters fold by plain ASCII case conversion, unless
+    // width or kana are to be ignored as well.
+    const bool bAsciiFastPath = moduleLoaded == TransliterationFlags::IGNORE_CASE && hasAsciiCaseMapping();
+
     while (NOT_END_OF_STR1 && NOT_END_OF_STR2) {
-        c1 = i18nutil::casefolding::getNextChar(unistr1, nMatch1, nCount1, e1, aLocale, nMappingType, moduleLoaded);
-        c2 = i18nutil::casefolding::getNextChar(unistr2, nMatch2, nCount2, e2, aLocale, nMappingType, moduleLoaded);
+        if (bAsciiFastPath && e1.current >= e1.element.nmap && e2.current >= e2.element.nmap
+            && unistr1[nMatch1] < 0x80 && unistr2[nMatch2] < 0x80)
+        {
+            c1 = static_cast<sal_Unicode>(rtl::toAsciiLowerCase(unistr1[nMatch1++]));
+            c2 = static_cast<sal_Unicode>(rtl::toAsciiLowerCase(unistr2[nMatch2++]));
+        }
+        else
+        {
+            c1 = i18nutil::casefolding::getNextChar(unistr1, nMatch1, nCount1, e1, aLocale, nMappingType, moduleLoaded);
+            c2 = i18nutil::casefolding::getNextChar(unistr2, nMatch2, nCount2, e2, aLocale, nMappingType, moduleLoaded);
+        }
         if (c1 != c2) {
         nMatch1--; nMatch2--;
         return c1 > c2 ? 1 : -1;
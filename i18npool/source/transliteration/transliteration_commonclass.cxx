@@ -20,6 +20,8 @@
 #include <transliteration_commonclass.hxx>
 #include <cppuhelper/supportsservice.hxx>
 
+#include <numeric>
+
 using namespace ::com::sun::star::uno;
 using namespace ::com::sun::star::i18n;
 using namespace ::com::sun::star::lang;
@@ -115,6 +117,14 @@ transliteration_commonclass::transliterateChar2String( sal_Unicode inChar )
     return transliteration_commonclass::transliterateString2String(OUString(&inChar, 1), 0, 1);
 }
 
+Sequence< sal_Int32 >
+transliteration_commonclass::identityOffsets( sal_Int32 startPos, sal_Int32 nCount )
+{
+    Sequence< sal_Int32 > aOffsets( nCount );
+    std::iota(aOffsets.getArray(), aOffsets.getArray() + nCount, startPos);
+    return aOffsets;
+}
+
 OUString SAL_CALL transliteration_commonclass::getImplementationName()
 {
     return OUString::createFromAscii(implementationName);
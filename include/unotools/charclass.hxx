@@ -61,6 +61,8 @@ class UNOTOOLS_DLLPUBLIC CharClass
 {
     LanguageTag                 maLanguageTag;
     css::uno::Reference< css::i18n::XCharacterClassification >    xCC;
+    /// ASCII case mapping is locale independent, except for tr, az and lt
+    bool                        mbAsciiCaseMapping;
 
     CharClass(const CharClass&) = delete;
     CharClass& operator=(const CharClass&) = delete;
@@ -28,13 +28,14 @@ namespace com::sun::star::uno {
         class XComponentContext;
 }
 
-namespace com::sun::star::i18n { class XCollator; }
+namespace com::sun::star::i18n { class XCollator; class XExtendedCollator; }
 namespace com::sun::star::lang { struct Locale; }
 
 class UNOTOOLS_DLLPUBLIC CollatorWrapper
 {
     private:
         css::uno::Reference< css::i18n::XCollator >        mxInternationalCollator;
+        css::uno::Reference< css::i18n::XExtendedCollator > mxExtendedCollator;
 
     public:
 
@@ -45,6 +46,13 @@ class UNOTOOLS_DLLPUBLIC CollatorWrapper
         compareString (
                 const OUString& s1, const OUString& s2) const;
 
+        /** Binary sort key of rStr for the loaded collator, comparable
+            bytewise in place of compareString(). Empty if sort keys are
+            not available, in which case compareString() has to be used. */
+        css::uno::Sequence< sal_Int8 >
+        getSortKey (
+                const OUString& rStr) const;
+
         css::uno::Sequence< OUString >
         listCollatorAlgorithms (
                 const css::lang::Locale& rLocale) const;
@@ -25,6 +25,8 @@
 #include <cppuhelper/weak.hxx>
 #include <com/sun/star/linguistic2/XLinguProperties.hpp>
 #include <i18nlangtag/languagetag.hxx>
+#include <o3tl/hash_combine.hxx>
+#include <o3tl/safeint.hxx>
 #include <tools/debug.hxx>
 #include <osl/mutex.hxx>
 #include <osl/thread.h>
@@ -239,6 +241,103 @@ bool LoadDictionary(HDInfo& rDict)
     rDict.eEnc = getTextEncodingFromCharset(dict->cset);
     return true;
 }
+
+// number of distinct words remembered per hyphenation dictionary
+constexpr size_t HYPHEN_CACHE_SIZE = 4096;
+}
+
+size_t HyphenCacheKeyHash::operator()(const HyphenCacheKey& r) const
+{
+    size_t nSeed = r.aWord.hashCode();
+    o3tl::hash_combine(nSeed, r.nMinLead);
+    o3tl::hash_combine(nSeed, r.nMinTrail);
+    return nSeed;
+}
+
+std::shared_ptr<const HyphenPatterns> Hyphenator::getPatterns(HDInfo& rDict, const OUString& rWord,
+                                                              sal_Int16 minLead, sal_Int16 minTrail)
+{
+    HyphenCacheKey aKey{ rWord, minLead, minTrail };
+    {
+        std::scoped_lock aGuard(maCacheMutex);
+        if (!rDict.apCache)
+            rDict.apCache.reset(new HyphenCache(HYPHEN_CACHE_SIZE));
+        auto it = rDict.apCache->find(aKey);
+        if (it != rDict.apCache->end())
+            return it->second;
+    }
+
+    HyphenDict *dict = rDict.aPtr;
+    rtl_TextEncoding eEnc = rDict.eEnc;
+
+    // now convert word to all lowercase for pattern recognition
+    OUString nTerm(makeLowerCase(rWord, rDict.apCC.get()));
+
+    // now convert word to needed encoding
+    OString encWord(OU2ENC(nTerm,eEnc));
+
+    int wordlen = encWord.getLength();
+    auto pPatterns = std::make_shared<HyphenPatterns>();
+    std::vector<char>& hyphens = pPatterns->aHyphens;
+    hyphens.resize(wordlen + 5);
+
+    // now strip off any ending periods
+    int n = wordlen-1;
+    while((n >=0) && (encWord[n] == '.'))
+        n--;
+    n++;
+    if (n > 0)
+    {
+        char ** rep = nullptr; // replacements of discretionary hyphenation
+        int * pos = nullptr; // array of [hyphenation point] minus [deletion position]
+        int * cut = nullptr; // length of deletions in original word
+
+        const bool bFailed = 0 != hnj_hyphen_hyphenate3( dict, encWord.getStr(), n, hyphens.data(), nullptr,
+                &rep, &pos, &cut, minLead, minTrail,
+                std::max<sal_Int16>(dict->clhmin, std::max<sal_Int16>(dict->clhmin, 2) + std::max(0, minLead  - std::max<sal_Int16>(dict->lhmin, 2))),
+                std::max<sal_Int16>(dict->crhmin, std::max<sal_Int16>(dict->crhmin, 2) + std::max(0, minTrail - std::max<sal_Int16>(dict->rhmin, 2))) );
+        if (rep)
+        {
+            if (!bFailed)
+                pPatterns->aRep.resize(n);
+            for(int j = 0; j < n; j++)
+            {
+                if (rep[j])
+                {
+                    if (!bFailed)
+                        pPatterns->aRep[j] = rep[j];
+                    free(rep[j]);
+                }
+            }
+            free(rep);
+        }
+        if (pos)
+        {
+            if (!bFailed)
+                pPatterns->aPos.assign(pos, pos + n);
+            free(pos);
+        }
+        if (cut)
+        {
+            if (!bFailed)
+                pPatterns->aCut.assign(cut, cut + n);
+            free(cut);
+        }
+        // whoops something did not work
+        if (bFailed)
+            return nullptr;
+    }
+
+    // now backfill hyphens[] for any removed trailing periods
+    hyphens.resize(wordlen);
+    for (int c = n; c < wordlen; c++)
+        hyphens[c] = '0';
+    pPatterns->nLen = n;
+
+    std::scoped_lock aGuard(maCacheMutex);
+    rDict.apCache->insert(
+        std::pair<HyphenCacheKey, std::shared_ptr<const HyphenPatterns>>(std::move(aKey), pPatterns));
+    return pPatterns;
 }
 
 Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWord,
@@ -279,7 +378,6 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
         }
 
         // otherwise hyphenate the word with that dictionary
-        HyphenDict *dict = mvDicts[k].aPtr;
         eEnc = mvDicts[k].eEnc;
         CharClass * pCC =  mvDicts[k].apCC.get();
 
@@ -313,54 +411,17 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
         }
         OUString nWord(rBuf.makeStringAndClear());
 
-        // now convert word to all lowercase for pattern recognition
-        OUString nTerm(makeLowerCase(nWord, pCC));
-
-        // now convert word to needed encoding
-        OString encWord(OU2ENC(nTerm,eEnc));
-
-        int wordlen = encWord.getLength();
-        std::unique_ptr<char[]> lcword(new char[wordlen + 1]);
-        std::unique_ptr<char[]> hyphens(new char[wordlen + 5]);
-
-        char ** rep = nullptr; // replacements of discretionary hyphenation
-        int * pos = nullptr; // array of [hyphenation point] minus [deletion position]
-        int * cut = nullptr; // length of deletions in original word
-
-        // copy converted word into simple char buffer
-        strcpy(lcword.get(),encWord.getStr());
-
-        // now strip off any ending periods
-        int n = wordlen-1;
-        while((n >=0) && (lcword[n] == '.'))
-            n--;
-        n++;
-        if (n > 0)
-        {
-            const bool bFailed = 0 != hnj_hyphen_hyphenate3( dict, lcword.get(), n, hyphens.get(), nullptr,
-                    &rep, &pos, &cut, minLead, minTrail,
-                    std::max<sal_Int16>(dict->clhmin, std::max<sal_Int16>(dict->clhmin, 2) + std::max(0, minLead  - std::max<sal_Int16>(dict->lhmin, 2))),
-                    std::max<sal_Int16>(dict->crhmin, std::max<sal_Int16>(dict->crhmin, 2) + std::max(0, minTrail - std::max<sal_Int16>(dict->rhmin, 2))) );
-            if (bFailed)
-            {
-                // whoops something did not work
-                if (rep)
-                {
-                    for(int j = 0; j < n; j++)
-                    {
-                        if (rep[j]) free(rep[j]);
-                    }
-                    free(rep);
-                }
-                if (pos) free(pos);
-                if (cut) free(cut);
-                return nullptr;
-            }
-        }
+        // the pattern matcher result does not depend on nMaxLeading, so it
+        // is shared between repeated words
+        std::shared_ptr<const HyphenPatterns> pPatterns = getPatterns(mvDicts[k], nWord, minLead, minTrail);
+        if (!pPatterns)
+            return nullptr;
 
-        // now backfill hyphens[] for any removed trailing periods
-        for (int c = n; c < wordlen; c++) hyphens[c] = '0';
-        hyphens[wordlen] = '\0';
+        const std::vector<char>& hyphens = pPatterns->aHyphens;
+        const std::vector<OString>& rep = pPatterns->aRep;
+        const std::vector<int>& pos = pPatterns->aPos;
+        const std::vector<int>& cut = pPatterns->aCut;
+        const int n = pPatterns->nLen;
 
         sal_Int32 Leading =  GetPosInWordToCheck( aWord, nMaxLeading );
 
@@ -368,7 +429,7 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
         {
             int leftrep = 0;
             bool hit = (n >= minLen);
-            if (!rep || !rep[i])
+            if (rep.empty() || rep[i].isEmpty())
             {
                 hit = hit && (hyphens[i]&1) && (i < Leading);
                 hit = hit && (i >= (minLead-1) );
@@ -377,7 +438,7 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
             else
             {
                 // calculate change character length before hyphenation point signed with '='
-                for (char * c = rep[i]; *c && (*c != '='); c++)
+                for (const char * c = rep[i].getStr(); *c && (*c != '='); c++)
                 {
                     if (eEnc == RTL_TEXTENCODING_UTF8)
                     {
@@ -389,12 +450,12 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
                 }
                 hit = hit && (hyphens[i]&1) && ((i + leftrep - pos[i]) < Leading);
                 hit = hit && ((i + leftrep - pos[i]) >= (minLead-1) );
-                hit = hit && ((n - i - 1 + sal::static_int_cast< sal_sSize >(strlen(rep[i])) - leftrep - 1) >= minTrail);
+                hit = hit && ((n - i - 1 + rep[i].getLength() - leftrep - 1) >= minTrail);
             }
             if (hit)
             {
                 nHyphenationPos = i;
-                if (rep && rep[i])
+                if (!rep.empty() && !rep[i].isEmpty())
                 {
                     nHyphenationPosAlt = i - pos[i];
                     nHyphenationPosAltHyph = i + leftrep - pos[i];
@@ -408,17 +469,11 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
         }
         else
         {
-            if (rep && rep[nHyphenationPos])
+            if (!rep.empty() && !rep[nHyphenationPos].isEmpty())
             {
                 // remove equal sign
-                char * s = rep[nHyphenationPos];
-                int eq = 0;
-                for (; *s; s++)
-                {
-                    if (*s == '=') eq = 1;
-                    if (eq) *s = *(s + 1);
-                }
-                OUString repHyphlow(rep[nHyphenationPos], strlen(rep[nHyphenationPos]), eEnc);
+                OString aRepHyph(rep[nHyphenationPos].replaceFirst("=", ""));
+                OUString repHyphlow(aRepHyph.getStr(), aRepHyph.getLength(), eEnc);
                 OUString repHyph;
                 switch (ct)
                 {
@@ -457,16 +512,6 @@ Reference< XHyphenatedWord > SAL_CALL Hyphenator::hyphenate( const OUString& aWo
             }
         }
 
-        if (rep)
-        {
-            for(int j = 0; j < n; j++)
-            {
-                if (rep[j]) free(rep[j]);
-            }
-            free(rep);
-        }
-        if (pos) free(pos);
-        if (cut) free(cut);
         return xRes;
     }
     return nullptr;
@@ -516,7 +561,6 @@ Reference< XPossibleHyphens > SAL_CALL Hyphenator::createPossibleHyphens( const
     // if we have a hyphenation dictionary matching this locale
     if (k != -1)
     {
-        HyphenDict *dict = nullptr;
         // if this dictionary has not been loaded yet do that
         if (!mvDicts[k].aPtr)
         {
@@ -525,9 +569,7 @@ Reference< XPossibleHyphens > SAL_CALL Hyphenator::createPossibleHyphens( const
         }
 
         // otherwise hyphenate the word with that dictionary
-        dict = mvDicts[k].aPtr;
         rtl_TextEncoding eEnc = mvDicts[k].eEnc;
-        CharClass* pCC = mvDicts[k].apCC.get();
 
         // we don't want to work with a default text encoding since following incorrect
         // results may occur only for specific text and thus may be hard to notice.
@@ -551,59 +593,16 @@ Reference< XPossibleHyphens > SAL_CALL Hyphenator::createPossibleHyphens( const
         }
         OUString nWord(rBuf.makeStringAndClear());
 
-        // now convert word to all lowercase for pattern recognition
-        OUString nTerm(makeLowerCase(nWord, pCC));
-
-        // now convert word to needed encoding
-        OString encWord(OU2ENC(nTerm,eEnc));
-
-        sal_Int32 wordlen = encWord.getLength();
-        std::unique_ptr<char[]> lcword(new char[wordlen+1]);
-        std::unique_ptr<char[]> hyphens(new char[wordlen+5]);
-        char ** rep = nullptr; // replacements of discretionary hyphenation
-        int * pos = nullptr; // array of [hyphenation point] minus [deletion position]
-        int * cut = nullptr; // length of deletions in original word
-
-        // copy converted word into simple char buffer
-        strcpy(lcword.get(),encWord.getStr());
-
-        // first remove any trailing periods
-        sal_Int32 n = wordlen-1;
-        while((n >=0) && (lcword[n] == '.'))
-            n--;
-        n++;
-        if (n > 0)
-        {
-            const bool bFailed = 0 != hnj_hyphen_hyphenate3(dict, lcword.get(), n, hyphens.get(), nullptr,
-                    &rep, &pos, &cut, minLead, minTrail,
-                    std::max<sal_Int16>(dict->clhmin, std::max<sal_Int16>(dict->clhmin, 2) + std::max(0, minLead - std::max<sal_Int16>(dict->lhmin, 2))),
-                    std::max<sal_Int16>(dict->crhmin, std::max<sal_Int16>(dict->crhmin, 2) + std::max(0, minTrail - std::max<sal_Int16>(dict->rhmin, 2))) );
-            if (bFailed)
-            {
-                if (rep)
-                {
-                    for(int j = 0; j < n; j++)
-                    {
-                        if (rep[j]) free(rep[j]);
-                    }
-                    free(rep);
-                }
-                if (pos) free(pos);
-                if (cut) free(cut);
-
-                return nullptr;
-            }
-        }
-        // now backfill hyphens[] for any removed periods
-        for (sal_Int32 c = n; c < wordlen; c++)
-            hyphens[c] = '0';
-        hyphens[wordlen] = '\0';
+        std::shared_ptr<const HyphenPatterns> pPatterns = getPatterns(mvDicts[k], nWord, minLead, minTrail);
+        if (!pPatterns)
+            return nullptr;
 
+        const std::vector<char>& hyphens = pPatterns->aHyphens;
         sal_Int32 nHyphCount = 0;
 
-        for ( sal_Int32 i = 0; i < encWord.getLength(); i++)
+        for (char c : hyphens)
         {
-            if (hyphens[i]&1)
+            if (c&1)
                 nHyphCount++;
         }
 
@@ -616,7 +615,7 @@ Reference< XPossibleHyphens > SAL_CALL Hyphenator::createPossibleHyphens( const
         {
             hyphenatedWordBuffer.append(aWord[i]);
             // hyphenation position
-            if (hyphens[i]&1)
+            if (o3tl::make_unsigned(i) < hyphens.size() && (hyphens[i]&1))
             {
                 // linguistic::PossibleHyphens is stuck with
                 // css::uno::Sequence<sal_Int16> because of
@@ -642,17 +641,6 @@ Reference< XPossibleHyphens > SAL_CALL Hyphenator::createPossibleHyphens( const
         Reference< XPossibleHyphens > xRes = PossibleHyphens::CreatePossibleHyphens(
             aWord, LinguLocaleToLanguage( aLocale ), hyphenatedWord, aHyphPos);
 
-        if (rep)
-        {
-            for(int j = 0; j < n; j++)
-            {
-                if (rep[j]) free(rep[j]);
-            }
-            free(rep);
-        }
-        if (pos) free(pos);
-        if (cut) free(cut);
-
         return xRes;
     }
 
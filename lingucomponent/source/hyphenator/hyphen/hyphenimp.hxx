@@ -31,6 +31,7 @@
 #include <com/sun/star/linguistic2/XHyphenator.hpp>
 #include <com/sun/star/linguistic2/XLinguServiceEventBroadcaster.hpp>
 
+#include <o3tl/lru_map.hxx>
 #include <unotools/charclass.hxx>
 
 #include <linguistic/misc.hxx>
@@ -41,17 +42,49 @@
 
 #include <hyphen.h>
 
+#include <memory>
+#include <mutex>
+#include <vector>
+
 using namespace ::com::sun::star::uno;
 using namespace ::com::sun::star::beans;
 using namespace ::com::sun::star::lang;
 using namespace ::com::sun::star::linguistic2;
 
+// result of the libhyphen pattern matcher for one word, independent of
+// the line layout (nMaxLeading) so that it can be reused for repeated words
+struct HyphenPatterns {
+  std::vector<char>    aHyphens; // odd values mark a break after the character
+  std::vector<OString> aRep;     // discretionary replacements, empty if there are none
+  std::vector<int>     aPos;
+  std::vector<int>     aCut;
+  int                  nLen = 0; // encoded word length without trailing periods
+};
+
+struct HyphenCacheKey {
+  OUString  aWord;
+  sal_Int16 nMinLead;
+  sal_Int16 nMinTrail;
+
+  bool operator==(const HyphenCacheKey& r) const
+  {
+      return nMinLead == r.nMinLead && nMinTrail == r.nMinTrail && aWord == r.aWord;
+  }
+};
+
+struct HyphenCacheKeyHash {
+  size_t operator()(const HyphenCacheKey& r) const;
+};
+
+typedef o3tl::lru_map<HyphenCacheKey, std::shared_ptr<const HyphenPatterns>, HyphenCacheKeyHash> HyphenCache;
+
 struct HDInfo {
   HyphenDict *     aPtr;
   OUString         aName;
   Locale           aLoc;
   rtl_TextEncoding eEnc;
   std::unique_ptr<CharClass> apCC;
+  std::unique_ptr<HyphenCache> apCache;
 };
 
 class Hyphenator :
@@ -71,6 +104,7 @@ class Hyphenator :
     ::comphelper::OInterfaceContainerHelper3<XEventListener> aEvtListeners;
     std::unique_ptr<linguistic::PropertyHelper_Hyphenation> pPropHelper;
     bool                                    bDisposing;
+    std::mutex                              maCacheMutex;
 
     Hyphenator(const Hyphenator &) = delete;
     Hyphenator & operator = (const Hyphenator &) = delete;
@@ -116,6 +150,9 @@ public:
     virtual Sequence< OUString > SAL_CALL getSupportedServiceNames() override;
 
 private:
+        std::shared_ptr<const HyphenPatterns> getPatterns(HDInfo& rDict, const OUString& rWord,
+                                                          sal_Int16 minLead, sal_Int16 minTrail);
+
         static OUString makeLowerCase(const OUString&, CharClass const *);
         static OUString makeUpperCase(const OUString&, CharClass const *);
         static OUString makeInitCap(const OUString&, CharClass const *);
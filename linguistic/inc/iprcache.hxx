@@ -30,9 +30,11 @@
 
 #include <rtl/ref.hxx>
 #include <i18nlangtag/lang.h>
+#include <o3tl/lru_map.hxx>
 
 #include <set>
 #include <map>
+#include <optional>
 
 namespace linguistic
 {
@@ -78,6 +80,11 @@ class SpellCache final
     typedef std::map< LanguageType, WordList_t >  LangWordList_t;
     LangWordList_t  aWordLists;
 
+    // final verdict of the dispatcher (including the dictionary list) per word
+    typedef o3tl::lru_map< OUString, bool >           ResultList_t;
+    typedef std::map< LanguageType, ResultList_t >    LangResultList_t;
+    LangResultList_t  aResultLists;
+
     SpellCache(const SpellCache &) = delete;
     SpellCache & operator = (const SpellCache &) = delete;
 
@@ -87,9 +94,13 @@ public:
 
     // called from FlushListener
     void    Flush();
+    void    FlushResults();
 
     void    AddWord( const OUString& rWord, LanguageType nLang );
     bool    CheckWord( const OUString& rWord, LanguageType nLang );
+
+    void    AddResult( const OUString& rWord, LanguageType nLang, bool bIsValid );
+    std::optional<bool> CheckResult( const OUString& rWord, LanguageType nLang );
 };
 
 
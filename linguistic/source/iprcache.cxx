@@ -36,6 +36,8 @@ using namespace com::sun::star::linguistic2;
 namespace linguistic
 {
 
+// number of cached spell checking results per language
+constexpr size_t RESULT_CACHE_SIZE = 20000;
 
 #define NUM_FLUSH_PROPS     6
 
@@ -158,10 +160,18 @@ void SAL_CALL FlushListener::processDictionaryListEvent(
             DictionaryListEventFlags::DEL_POS_ENTRY     |
             DictionaryListEventFlags::ACTIVATE_NEG_DIC  |
             DictionaryListEventFlags::DEACTIVATE_POS_DIC;
+    // words may become correct by these, which only affects cached results
+    sal_Int16 const nFlushResultFlags =
+            DictionaryListEventFlags::ADD_POS_ENTRY     |
+            DictionaryListEventFlags::DEL_NEG_ENTRY     |
+            DictionaryListEventFlags::ACTIVATE_POS_DIC  |
+            DictionaryListEventFlags::DEACTIVATE_NEG_DIC;
     bool bFlush = 0 != (nEvt & nFlushFlags);
 
     if (bFlush)
         mrSpellCache.Flush();
+    else if (0 != (nEvt & nFlushResultFlags))
+        mrSpellCache.FlushResults();
 }
 
 
@@ -202,6 +212,13 @@ void SpellCache::Flush()
     MutexGuard  aGuard( GetLinguMutex() );
     // clear word list
     LangWordList_t().swap(aWordLists);
+    LangResultList_t().swap(aResultLists);
+}
+
+void SpellCache::FlushResults()
+{
+    MutexGuard  aGuard( GetLinguMutex() );
+    LangResultList_t().swap(aResultLists);
 }
 
 bool SpellCache::CheckWord( const OUString& rWord, LanguageType nLang )
@@ -222,6 +239,25 @@ void SpellCache::AddWord( const OUString& rWord, LanguageType nLang )
     rList.insert( rWord );
 }
 
+void SpellCache::AddResult( const OUString& rWord, LanguageType nLang, bool bIsValid )
+{
+    MutexGuard  aGuard( GetLinguMutex() );
+    ResultList_t & rList = aResultLists.try_emplace( nLang, RESULT_CACHE_SIZE ).first->second;
+    rList.insert( std::make_pair( rWord, bIsValid ) );
+}
+
+std::optional<bool> SpellCache::CheckResult( const OUString& rWord, LanguageType nLang )
+{
+    MutexGuard  aGuard( GetLinguMutex() );
+    const LangResultList_t::iterator aLangIt = aResultLists.find( nLang );
+    if (aLangIt == aResultLists.end())
+        return std::nullopt;
+    const ResultList_t::const_iterator aIt = aLangIt->second.find( rWord );
+    if (aIt == aLangIt->second.end())
+        return std::nullopt;
+    return aIt->second;
+}
+
 }   // namespace linguistic
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -277,6 +277,16 @@ bool SpellCheckerDispatcher::isValid_Impl(
         if (IsIgnoreControlChars( rProperties, GetPropSet() ))
             RemoveControlChars( aChkWord );
 
+        // Words checked without temporary settings are remembered together
+        // with the outcome of the dictionary list cross-check below.
+        const bool bCacheResult = !rProperties.hasElements();
+        if (bCacheResult)
+        {
+            std::optional<bool> oCached = GetCache().CheckResult( aChkWord, nLanguage );
+            if (oCached)
+                return *oCached;
+        }
+
         sal_Int32 nLen = pEntry->aSvcRefs.getLength();
         DBG_ASSERT( nLen == pEntry->aSvcImplNames.getLength(),
                 "lng : sequence length mismatch");
@@ -403,6 +413,9 @@ bool SpellCheckerDispatcher::isValid_Impl(
                 }
             }
         }
+
+        if (bCacheResult)
+            GetCache().AddResult( aChkWord, nLanguage, bRes );
     }
 
     return bRes;
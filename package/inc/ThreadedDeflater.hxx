@@ -42,6 +42,7 @@ class ThreadedDeflater final
     std::vector<std::vector<sal_Int8>> outBuffers;
     std::shared_ptr<comphelper::ThreadTaskTag> threadTaskTag;
     css::uno::Sequence<sal_Int8> inBuffer;
+    css::uno::Sequence<sal_Int8> nextInBuffer;
     css::uno::Sequence<sal_Int8> prevDataBlock;
     std::function<void(const css::uno::Sequence<sal_Int8>&, sal_Int32)> maProcessOutputFunc;
     sal_Int64 totalIn;
@@ -87,11 +87,18 @@ void ThreadedDeflater::deflateWrite(
     maProcessOutputFunc = aProcessOutputFunc;
     bool firstTask = true;
 
-    while (xInStream->available() > 0)
+    // Reading the next batch and running aProcessInputFunc on it (checksum, digest) overlaps
+    // with the compression of the current one, so the tasks don't wait for the input side.
+    bool hasInput = xInStream->available() > 0;
+    sal_Int64 inputBytes = 0;
+    if (hasInput)
     {
-        sal_Int64 inputBytes = xInStream->readBytes(inBuffer, batchSize);
+        inputBytes = xInStream->readBytes(inBuffer, batchSize);
         aProcessInputFunc(inBuffer, inputBytes);
         totalIn += inputBytes;
+    }
+    while (hasInput)
+    {
         int sequence = 0;
         bool lastBatch = xInStream->available() <= 0;
         sal_Int64 bytesPending = inputBytes;
@@ -109,6 +116,23 @@ void ThreadedDeflater::deflateWrite(
 
         assert(bytesPending == 0);
 
+        sal_Int64 nextInputBytes = 0;
+        if (!lastBatch)
+        {
+            try
+            {
+                nextInputBytes = xInStream->readBytes(nextInBuffer, batchSize);
+                aProcessInputFunc(nextInBuffer, nextInputBytes);
+                totalIn += nextInputBytes;
+            }
+            catch (...)
+            {
+                // the tasks still work on our buffers
+                comphelper::ThreadPool::getSharedOptimalPool().waitUntilDone(threadTaskTag);
+                throw;
+            }
+        }
+
         comphelper::ThreadPool::getSharedOptimalPool().waitUntilDone(threadTaskTag);
 
         if (!lastBatch)
@@ -119,6 +143,10 @@ void ThreadedDeflater::deflateWrite(
         }
 
         processDeflatedBuffers();
+
+        std::swap(inBuffer, nextInBuffer);
+        inputBytes = nextInputBytes;
+        hasInput = !lastBatch;
     }
 }
 
@@ -144,6 +172,7 @@ void ThreadedDeflater::processDeflatedBuffers()
 void ThreadedDeflater::clear()
 {
     inBuffer = uno::Sequence<sal_Int8>();
+    nextInBuffer = uno::Sequence<sal_Int8>();
     outBuffers.clear();
 }
 
@@ -0,0 +1,65 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#pragma once
+
+#include <com/sun/star/uno/Sequence.hxx>
+#include <rtl/ustring.hxx>
+
+#include <unordered_map>
+
+class CollatorWrapper;
+namespace svl { class SharedString; }
+
+/**
+ * Per-document cache of collation sort keys of shared cell strings.
+ *
+ * Sorting compares the same strings O(n log n) times; with the sort key of
+ * each string computed once, every comparison is a plain memcmp. Keys are
+ * looked up by the shared string's data pointer, which identifies a string
+ * within the document's string pool. Each entry holds a reference to its
+ * string, so that a pool purge can't recycle the address while the entry
+ * is alive.
+ *
+ * The cache is bound to one collator configuration at a time and dropped
+ * whenever a different one is set.
+ */
+class ScCollationKeyCache
+{
+    struct Entry
+    {
+        OUString maStr;
+        css::uno::Sequence<sal_Int8> maKey;
+    };
+
+    std::unordered_map<const rtl_uString*, Entry> maKeys;
+    const CollatorWrapper* mpCollator;
+    OUString maCollatorSignature;
+    bool mbKeysAvailable;
+
+    css::uno::Sequence<sal_Int8> getKey(const svl::SharedString& rStr);
+
+public:
+    ScCollationKeyCache();
+    ~ScCollationKeyCache();
+
+    /**
+     * Set the collator to compare with. rSignature has to describe the
+     * collator's locale, algorithm and options; cached keys are kept only
+     * if it is the same as the one previously set.
+     */
+    void setCollator(const CollatorWrapper& rCollator, const OUString& rSignature);
+
+    /** Compare like CollatorWrapper::compareString() of the set collator. */
+    sal_Int32 compare(const svl::SharedString& rStr1, const svl::SharedString& rStr2);
+
+    void clear();
+};
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
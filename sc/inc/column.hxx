@@ -149,6 +149,9 @@ public:
     void        ApplyPatternArea( SCROW nStartRow, SCROW nEndRow, const ScPatternAttr& rPatAttr,
                                   ScEditDataArray* pDataArray = nullptr,
                                   bool* const pIsChanged = nullptr);
+    void        ApplyCacheArea( SCROW nStartRow, SCROW nEndRow, SfxItemPoolCache* pCache,
+                                ScEditDataArray* pDataArray = nullptr,
+                                bool* const pIsChanged = nullptr);
     void        MergePatternArea( ScMergePatternState& rState, SCROW nRow1, SCROW nRow2, bool bDeep ) const;
 
     sal_uInt32  GetNumberFormat( const ScInterpreterContext& rContext, SCROW nRow ) const;
@@ -437,6 +440,14 @@ public:
     void SetValue( SCROW nRow, double fVal );
     void SetValues( const SCROW nRow, const std::vector<double>& rVals );
     void SetValue( sc::ColumnBlockPosition& rBlockPos, SCROW nRow, double fVal, bool bBroadcast = true );
+
+    /**
+     * Set a run of numeric or string cells starting at nRow in one block
+     * operation.  Pass bBroadcast=false only when the caller broadcasts the
+     * whole area afterwards, as pasting from clipboard does.
+     */
+    void SetValues( sc::ColumnBlockPosition& rBlockPos, SCROW nRow, const std::vector<double>& rVals, bool bBroadcast = true );
+    void SetRawStrings( sc::ColumnBlockPosition& rBlockPos, SCROW nRow, const std::vector<svl::SharedString>& rStrs, bool bBroadcast = true );
     void        SetError( SCROW nRow, const FormulaError nError);
 
     OUString    GetString( SCROW nRow, const ScInterpreterContext* pContext = nullptr ) const
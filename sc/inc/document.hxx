@@ -135,6 +135,7 @@ class ScBroadcastAreaSlotMachine;
 class ScChangeViewSettings;
 class ScChartListenerCollection;
 class ScClipOptions;
+class ScCollationKeyCache;
 class ScColumn;
 class ScConditionalFormat;
 class ScConditionalFormatList;
@@ -473,6 +474,7 @@ private:
 
     std::shared_mutex mScLookupMutex; // protection for thread-unsafe parts of handling ScLookup
     std::unique_ptr<ScSortedRangeCacheMap> mxScSortedRangeCache; // cache for unsorted lookups
+    std::unique_ptr<ScCollationKeyCache> mpCollationKeyCache; // sort keys of shared strings, created on demand
 
     static const sal_uInt16 nSrcVer;                        // file version (load/save)
     sal_uInt16              nFormulaTrackCount;
@@ -1404,6 +1406,10 @@ public:
                     /** Zap all caches. */
     void            ClearLookupCaches();
 
+                    /** Sort keys of the document's shared strings, used when
+                        sorting cell ranges. Not thread-safe. */
+    ScCollationKeyCache& GetCollationKeyCache();
+
                     // calculate automatically
     SC_DLLPUBLIC void SetAutoCalc( bool bNewAutoCalc );
     SC_DLLPUBLIC bool GetAutoCalc() const { return bAutoCalc; }
@@ -2134,8 +2140,7 @@ public:
 
     void                         FillInfo( ScTableInfo& rTabInfo, SCCOL nCol1, SCROW nRow1,
                                            SCCOL nCol2, SCROW nRow2, SCTAB nTab, double fColScale,
-                                           double fRowScale, bool bPageMode, bool bFormulaMode,
-                                           const ScMarkData* pMarkData = nullptr );
+                                           double fRowScale, bool bPageMode, bool bFormulaMode );
 
     SC_DLLPUBLIC SvNumberFormatter* GetFormatTable() const;
 
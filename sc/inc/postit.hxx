@@ -257,7 +257,8 @@ public:
     /** Shows or hides the caption temporarily (does not change internal visibility state). */
     void                ShowCaptionTemp( const ScAddress& rPos, bool bShow = true );
 
-    /** Updates caption position according to position of the passed cell. */
+    /** Updates caption position according to position of the passed cell.
+        Does nothing if the caption object has not been created yet. */
     void                UpdateCaptionPos( const ScAddress& rPos );
 
 private:
@@ -31,6 +31,8 @@
 
 #include <test/bootstrapfixture.hxx>
 #include <sfx2/docfile.hxx>
+#include <svl/intitem.hxx>
+#include <svl/numformat.hxx>
 
 #include <memory>
 
@@ -143,6 +145,8 @@ public:
     // tdf#80137
     void testCopyPasteMatrixFormula();
 
+    void testCopyPasteMixedRunOverFormulas();
+
     CPPUNIT_TEST_SUITE(TestCopyPaste);
 
     CPPUNIT_TEST(testCopyPaste);
@@ -247,6 +251,8 @@ public:
 
     CPPUNIT_TEST(testCopyPasteMatrixFormula);
 
+    CPPUNIT_TEST(testCopyPasteMixedRunOverFormulas);
+
     CPPUNIT_TEST_SUITE_END();
 
 private:
@@ -10830,6 +10836,82 @@ void TestCopyPaste::testCopyPasteMatrixFormula()
     m_pDoc->DeleteTab(0);
 }
 
+void TestCopyPaste::testCopyPasteMixedRunOverFormulas()
+{
+    sc::AutoCalcSwitch aACSwitch(*m_pDoc, true); // turn on auto calculation.
+
+    m_pDoc->InsertTab(0, "Test");
+
+    // A1:A6 holds numbers, strings and a date in one run.
+    m_pDoc->SetValue(ScAddress(0, 0, 0), 1.0);
+    m_pDoc->SetValue(ScAddress(0, 1, 0), 2.0);
+    m_pDoc->SetString(ScAddress(0, 2, 0), "a");
+    m_pDoc->SetString(ScAddress(0, 3, 0), "b");
+    m_pDoc->SetValue(ScAddress(0, 4, 0), 44927.0);
+    m_pDoc->SetValue(ScAddress(0, 5, 0), 3.0);
+
+    SvNumberFormatter* pFormatter = m_pDoc->GetFormatTable();
+    sal_uInt32 nFormat = pFormatter->GetFormatIndex(NF_DATE_SYS_DDMMYYYY, LANGUAGE_ENGLISH_US);
+    ScPatternAttr aNewAttrs(m_pDoc->GetPool());
+    aNewAttrs.GetItemSet().Put(SfxUInt32Item(ATTR_VALUE_FORMAT, nFormat));
+    m_pDoc->ApplyPatternAreaTab(0, 4, 0, 4, 0, aNewAttrs); // A5 is a date.
+
+    // E1 and E2 depend on the paste destination C1:C6.
+    m_pDoc->SetString(ScAddress(4, 0, 0), "=SUM(C1:C6)");
+    m_pDoc->SetString(ScAddress(4, 1, 0), "=C3&C4");
+
+    ScDocument aClipDoc(SCDOCMODE_CLIP);
+    copyToClip(m_pDoc, ScRange(0, 0, 0, 0, 5, 0), &aClipDoc); // A1:A6
+
+    auto lcl_paste = [&](InsertDeleteFlags nFlags) {
+        // Fill the destination with formula cells that the paste replaces.
+        for (SCROW nRow = 0; nRow <= 5; ++nRow)
+            m_pDoc->SetString(ScAddress(2, nRow, 0), "=100");
+        CPPUNIT_ASSERT_EQUAL(600.0, m_pDoc->GetValue(ScAddress(4, 0, 0)));
+
+        ScRange aDestRange(2, 0, 0, 2, 5, 0); // C1:C6
+        ScMarkData aMark(m_pDoc->GetSheetLimits());
+        aMark.SetMarkArea(aDestRange);
+        m_pDoc->CopyFromClip(aDestRange, aMark, nFlags, nullptr, &aClipDoc);
+    };
+
+    // Values and dates together: numbers are copied as whole runs.
+    lcl_paste(InsertDeleteFlags::CONTENTS);
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(2, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(2.0, m_pDoc->GetValue(ScAddress(2, 1, 0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("a"), m_pDoc->GetString(ScAddress(2, 2, 0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("b"), m_pDoc->GetString(ScAddress(2, 3, 0)));
+    CPPUNIT_ASSERT_EQUAL(44927.0, m_pDoc->GetValue(ScAddress(2, 4, 0)));
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(2, 5, 0)));
+    CPPUNIT_ASSERT_EQUAL(44933.0, m_pDoc->GetValue(ScAddress(4, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("ab"), m_pDoc->GetString(ScAddress(4, 1, 0)));
+
+    // Dates excluded.
+    lcl_paste(InsertDeleteFlags::VALUE | InsertDeleteFlags::STRING);
+    CPPUNIT_ASSERT_EQUAL(1.0, m_pDoc->GetValue(ScAddress(2, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(CELLTYPE_NONE, m_pDoc->GetCellType(ScAddress(2, 4, 0)));
+    CPPUNIT_ASSERT_EQUAL(3.0, m_pDoc->GetValue(ScAddress(2, 5, 0)));
+    CPPUNIT_ASSERT_EQUAL(6.0, m_pDoc->GetValue(ScAddress(4, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("ab"), m_pDoc->GetString(ScAddress(4, 1, 0)));
+
+    // Values excluded, dates included.
+    lcl_paste(InsertDeleteFlags::DATETIME | InsertDeleteFlags::STRING);
+    CPPUNIT_ASSERT_EQUAL(CELLTYPE_NONE, m_pDoc->GetCellType(ScAddress(2, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(44927.0, m_pDoc->GetValue(ScAddress(2, 4, 0)));
+    CPPUNIT_ASSERT_EQUAL(CELLTYPE_NONE, m_pDoc->GetCellType(ScAddress(2, 5, 0)));
+    CPPUNIT_ASSERT_EQUAL(44927.0, m_pDoc->GetValue(ScAddress(4, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("ab"), m_pDoc->GetString(ScAddress(4, 1, 0)));
+
+    // Both excluded: only the strings arrive.
+    lcl_paste(InsertDeleteFlags::STRING);
+    CPPUNIT_ASSERT_EQUAL(CELLTYPE_NONE, m_pDoc->GetCellType(ScAddress(2, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(CELLTYPE_NONE, m_pDoc->GetCellType(ScAddress(2, 4, 0)));
+    CPPUNIT_ASSERT_EQUAL(0.0, m_pDoc->GetValue(ScAddress(4, 0, 0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("ab"), m_pDoc->GetString(ScAddress(4, 1, 0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 CPPUNIT_TEST_SUITE_REGISTRATION(TestCopyPaste);
 
 CPPUNIT_PLUGIN_IMPLEMENT();
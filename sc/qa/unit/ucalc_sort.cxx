@@ -45,6 +45,7 @@ public:
     void testSortSingleRow();
     void testSortWithFormulaRefs();
     void testSortWithStrings();
+    void testSortCaseSensitiveStrings();
     void testSortInFormulaGroup();
     void testSortWithCellFormats();
     void testSortRefUpdate();
@@ -69,6 +70,7 @@ public:
     CPPUNIT_TEST(testSortSingleRow);
     CPPUNIT_TEST(testSortWithFormulaRefs);
     CPPUNIT_TEST(testSortWithStrings);
+    CPPUNIT_TEST(testSortCaseSensitiveStrings);
     CPPUNIT_TEST(testSortInFormulaGroup);
     CPPUNIT_TEST(testSortWithCellFormats);
     CPPUNIT_TEST(testSortRefUpdate);
@@ -550,6 +552,45 @@ void TestSort::testSortWithStrings()
     m_pDoc->DeleteTab(0);
 }
 
+void TestSort::testSortCaseSensitiveStrings()
+{
+    m_pDoc->InsertTab(0, "Test");
+
+    m_pDoc->SetString(ScAddress(0,0,0), "b");
+    m_pDoc->SetString(ScAddress(0,1,0), "A");
+    m_pDoc->SetString(ScAddress(0,2,0), "a");
+    m_pDoc->SetString(ScAddress(0,3,0), "ab");
+
+    ScSortParam aParam;
+    aParam.nCol1 = 0;
+    aParam.nCol2 = 0;
+    aParam.nRow1 = 0;
+    aParam.nRow2 = 3;
+    aParam.bCaseSens = true;
+    aParam.maKeyState[0].bDoSort = true;
+    aParam.maKeyState[0].bAscending = true;
+    aParam.maKeyState[0].nField = 0;
+
+    m_pDoc->Sort(0, aParam, false, true, nullptr, nullptr);
+
+    CPPUNIT_ASSERT_EQUAL(OUString("a"), m_pDoc->GetString(ScAddress(0,0,0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("A"), m_pDoc->GetString(ScAddress(0,1,0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("ab"), m_pDoc->GetString(ScAddress(0,2,0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("b"), m_pDoc->GetString(ScAddress(0,3,0)));
+
+    // Sorting again with the same collator reuses the cached sort keys.
+    aParam.maKeyState[0].bAscending = false;
+
+    m_pDoc->Sort(0, aParam, false, true, nullptr, nullptr);
+
+    CPPUNIT_ASSERT_EQUAL(OUString("b"), m_pDoc->GetString(ScAddress(0,0,0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("ab"), m_pDoc->GetString(ScAddress(0,1,0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("A"), m_pDoc->GetString(ScAddress(0,2,0)));
+    CPPUNIT_ASSERT_EQUAL(OUString("a"), m_pDoc->GetString(ScAddress(0,3,0)));
+
+    m_pDoc->DeleteTab(0);
+}
+
 void TestSort::testSortInFormulaGroup()
 {
     SortRefUpdateSetter aUpdateSet;
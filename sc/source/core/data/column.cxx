@@ -485,7 +485,13 @@ void ScColumnData::ApplyPatternArea( SCROW nStartRow, SCROW nEndRow, const ScPat
 {
     const SfxItemSet* pSet = &rPatAttr.GetItemSet();
     SfxItemPoolCache aCache( GetDoc().GetPool(), pSet );
-    pAttrArray->ApplyCacheArea( nStartRow, nEndRow, &aCache, pDataArray, pIsChanged );
+    ApplyCacheArea( nStartRow, nEndRow, &aCache, pDataArray, pIsChanged );
+}
+
+void ScColumnData::ApplyCacheArea( SCROW nStartRow, SCROW nEndRow, SfxItemPoolCache* pCache,
+                                   ScEditDataArray* pDataArray, bool* const pIsChanged )
+{
+    pAttrArray->ApplyCacheArea( nStartRow, nEndRow, pCache, pDataArray, pIsChanged );
 }
 
 void ScColumn::ApplyPatternIfNumberformatIncompatible( const ScRange& rRange,
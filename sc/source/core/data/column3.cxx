@@ -1211,11 +1211,21 @@ public:
         {
             case sc::element_type_numeric:
             {
-                // We need to copy numeric cells individually because of date type check.
                 sc::numeric_block::const_iterator it = sc::numeric_block::begin(*node.data);
                 std::advance(it, nOffset);
                 sc::numeric_block::const_iterator itEnd = it;
                 std::advance(itEnd, nDataSize);
+
+                if (bNumeric == bDateTime && !bAsLink)
+                {
+                    // No need to tell dates from plain numbers; copy the
+                    // whole run in one go.
+                    if (bNumeric)
+                        mrDestCol.SetValues(maDestBlockPos, nSrcRow1 + mnRowOffset, std::vector<double>(it, itEnd), false);
+                    break;
+                }
+
+                // We need to copy numeric cells individually because of date type check.
                 for (SCROW nSrcRow = nSrcRow1; it != itEnd; ++it, ++nSrcRow)
                 {
                     bool bCopy = mrCxt.isDateCell(mrSrcCol, nSrcRow) ? bDateTime : bNumeric;
@@ -1238,19 +1248,26 @@ public:
                 std::advance(it, nOffset);
                 sc::string_block::const_iterator itEnd = it;
                 std::advance(itEnd, nDataSize);
-                for (SCROW nSrcRow = nSrcRow1; it != itEnd; ++it, ++nSrcRow)
+
+                if (bAsLink)
                 {
-                    if (bAsLink)
+                    for (SCROW nSrcRow = nSrcRow1; it != itEnd; ++it, ++nSrcRow)
                         insertRefCell(nSrcRow, nSrcRow + mnRowOffset);
-                    else if (mpSharedStringPool)
-                    {
-                        // Re-intern the string if source is a different document.
-                        svl::SharedString aInterned = mpSharedStringPool->intern( (*it).getString());
-                        mrDestCol.SetRawString(maDestBlockPos, nSrcRow + mnRowOffset, aInterned);
-                    }
-                    else
-                        mrDestCol.SetRawString(maDestBlockPos, nSrcRow + mnRowOffset, *it);
+                    break;
                 }
+
+                std::vector<svl::SharedString> aStrs;
+                if (mpSharedStringPool)
+                {
+                    // Re-intern the strings if source is a different document.
+                    aStrs.reserve(nDataSize);
+                    for (; it != itEnd; ++it)
+                        aStrs.push_back(mpSharedStringPool->intern((*it).getString()));
+                }
+                else
+                    aStrs.assign(it, itEnd);
+
+                mrDestCol.SetRawStrings(maDestBlockPos, nSrcRow1 + mnRowOffset, aStrs, false);
             }
             break;
             case sc::element_type_edittext:
@@ -395,7 +395,15 @@ void ScColumn::duplicateSparkline(sc::CopyFromClipContext& rContext, sc::ColumnB
 
 void ScColumn::SetValues( const SCROW nRow, const std::vector<double>& rVals )
 {
-    if (!GetDoc().ValidRow(nRow))
+    sc::ColumnBlockPosition aBlockPos;
+    InitBlockPosition(aBlockPos);
+    SetValues(aBlockPos, nRow, rVals);
+}
+
+void ScColumn::SetValues(
+    sc::ColumnBlockPosition& rBlockPos, SCROW nRow, const std::vector<double>& rVals, bool bBroadcast )
+{
+    if (rVals.empty() || !GetDoc().ValidRow(nRow))
         return;
 
     SCROW nLastRow = nRow + rVals.size() - 1;
@@ -403,18 +411,22 @@ void ScColumn::SetValues( const SCROW nRow, const std::vector<double>& rVals )
         // Out of bound. Do nothing.
         return;
 
-    sc::CellStoreType::position_type aPos = maCells.position(nRow);
+    sc::CellStoreType::position_type aPos = maCells.position(rBlockPos.miCellPos, nRow);
     std::vector<SCROW> aNewSharedRows;
     DetachFormulaCells(aPos, rVals.size(), &aNewSharedRows);
 
-    maCells.set(nRow, rVals.begin(), rVals.end());
+    rBlockPos.miCellPos = maCells.set(aPos.first, nRow, rVals.begin(), rVals.end());
     std::vector<sc::CellTextAttr> aDefaults(rVals.size());
-    maCellTextAttrs.set(nRow, aDefaults.begin(), aDefaults.end());
+    rBlockPos.miCellTextAttrPos = maCellTextAttrs.set(
+        rBlockPos.miCellTextAttrPos, nRow, aDefaults.begin(), aDefaults.end());
 
     CellStorageModified();
 
     StartListeningUnshared( aNewSharedRows);
 
+    if (!bBroadcast)
+        return;
+
     std::vector<SCROW> aRows;
     aRows.reserve(rVals.size());
     for (SCROW i = nRow; i <= nLastRow; ++i)
@@ -423,6 +435,42 @@ void ScColumn::SetValues( const SCROW nRow, const std::vector<double>& rVals )
     BroadcastCells(aRows, SfxHintId::ScDataChanged);
 }
 
+void ScColumn::SetRawStrings(
+    sc::ColumnBlockPosition& rBlockPos, SCROW nRow, const std::vector<svl::SharedString>& rStrs,
+    bool bBroadcast )
+{
+    if (rStrs.empty() || !GetDoc().ValidRow(nRow))
+        return;
+
+    SCROW nLastRow = nRow + rStrs.size() - 1;
+    if (nLastRow > GetDoc().MaxRow())
+        // Out of bound. Do nothing.
+        return;
+
+    sc::CellStoreType::position_type aPos = maCells.position(rBlockPos.miCellPos, nRow);
+    std::vector<SCROW> aNewSharedRows;
+    DetachFormulaCells(aPos, rStrs.size(), &aNewSharedRows);
+
+    rBlockPos.miCellPos = maCells.set(aPos.first, nRow, rStrs.begin(), rStrs.end());
+    std::vector<sc::CellTextAttr> aDefaults(rStrs.size());
+    rBlockPos.miCellTextAttrPos = maCellTextAttrs.set(
+        rBlockPos.miCellTextAttrPos, nRow, aDefaults.begin(), aDefaults.end());
+
+    CellStorageModified();
+
+    StartListeningUnshared( aNewSharedRows);
+
+    if (!bBroadcast)
+        return;
+
+    std::vector<SCROW> aRows;
+    aRows.reserve(rStrs.size());
+    for (SCROW i = nRow; i <= nLastRow; ++i)
+        aRows.push_back(i);
+
+    BroadcastCells(aRows, SfxHintId::ScDataChanged);
+}
+
 void ScColumn::TransferCellValuesTo( SCROW nRow, size_t nLen, sc::CellValues& rDest )
 {
     if (!GetDoc().ValidRow(nRow))
@@ -68,6 +68,7 @@
 #include <recursionhelper.hxx>
 #include <lookupcache.hxx>
 #include <rangecache.hxx>
+#include <collationkeycache.hxx>
 #include <externalrefmgr.hxx>
 #include <viewdata.hxx>
 #include <viewutil.hxx>
@@ -409,6 +410,8 @@ ScDocument::~ScDocument()
     SAL_WARN_IF( pAutoNameCache, "sc.core", "AutoNameCache still set in dtor" );
 
     mpFormulaGroupCxt.reset();
+    // Release the cached strings before purging.
+    mpCollationKeyCache.reset();
     // Purge unused items if the string pool will be still used (e.g. by undo history).
     if(mpCellStringPool.use_count() > 1)
     {
@@ -1272,6 +1275,13 @@ void ScDocument::ClearLookupCaches()
     ScInterpreterContextPool::ClearLookupCaches();
 }
 
+ScCollationKeyCache& ScDocument::GetCollationKeyCache()
+{
+    if (!mpCollationKeyCache)
+        mpCollationKeyCache.reset(new ScCollationKeyCache);
+    return *mpCollationKeyCache;
+}
+
 bool ScDocument::IsCellInChangeTrack(const ScAddress &cell,Color *pColCellBorder)
 {
     ScChangeTrack* pTrack = GetChangeTrack();
@@ -1438,8 +1448,8 @@ SfxItemSet* ScDocument::GetPreviewFont( SCCOL nCol, SCROW nRow, SCTAB nTab )
     SfxItemSet* pRet = nullptr;
     if ( pPreviewFont )
     {
-        ScMarkData aSel = GetPreviewSelection();
-        if ( aSel.IsCellMarked( nCol, nRow ) && aSel.GetFirstSelected() == nTab )
+        const ScMarkData& rSel = GetPreviewSelection();
+        if ( rSel.IsCellMarked( nCol, nRow ) && rSel.GetFirstSelected() == nTab )
             pRet = pPreviewFont.get();
     }
     return pRet;
@@ -1447,10 +1457,15 @@ SfxItemSet* ScDocument::GetPreviewFont( SCCOL nCol, SCROW nRow, SCTAB nTab )
 
 ScStyleSheet* ScDocument::GetPreviewCellStyle( SCCOL nCol, SCROW nRow, SCTAB nTab )
 {
+    // Called for every painted cell, so don't look at (let alone copy) the
+    // selection unless a preview is active.
     ScStyleSheet* pRet = nullptr;
-    ScMarkData aSel = GetPreviewSelection();
-    if ( pPreviewCellStyle && aSel.IsCellMarked( nCol, nRow ) && aSel.GetFirstSelected() == nTab  )
-        pRet = pPreviewCellStyle;
+    if ( pPreviewCellStyle )
+    {
+        const ScMarkData& rSel = GetPreviewSelection();
+        if ( rSel.IsCellMarked( nCol, nRow ) && rSel.GetFirstSelected() == nTab )
+            pRet = pPreviewCellStyle;
+    }
     return pRet;
 }
 
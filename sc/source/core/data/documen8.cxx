@@ -84,6 +84,7 @@
 #include <tokenarray.hxx>
 #include <recursionhelper.hxx>
 
+#include <algorithm>
 #include <memory>
 #include <utility>
 
@@ -431,9 +432,32 @@ void ScDocument::CalculateInColumnInThread( ScInterpreterContext& rContext, cons
 void ScDocument::HandleStuffAfterParallelCalculation( SCCOL nColStart, SCCOL nColEnd, SCROW nRow, size_t nLen, SCTAB nTab, ScInterpreter* pInterpreter )
 {
     assert(!IsThreadedGroupCalcInProgress());
-    for( const DelayedSetNumberFormat& data : GetNonThreadedContext().maDelayedSetNumberFormat)
-        SetNumberFormat( ScAddress( data.mCol, data.mRow, nTab ), data.mnNumberFormat );
-    GetNonThreadedContext().maDelayedSetNumberFormat.clear();
+    std::vector<DelayedSetNumberFormat>& rDelayed = GetNonThreadedContext().maDelayedSetNumberFormat;
+    // Threads calculate interleaved rows, sort so that consecutive rows of a
+    // column with the same format get applied as one range, not cell by cell.
+    std::sort(rDelayed.begin(), rDelayed.end(),
+        [](const DelayedSetNumberFormat& rA, const DelayedSetNumberFormat& rB)
+        { return rA.mCol < rB.mCol || (rA.mCol == rB.mCol && rA.mRow < rB.mRow); });
+    for (size_t i = 0, n = rDelayed.size(); i < n; )
+    {
+        const DelayedSetNumberFormat& rFirst = rDelayed[i];
+        size_t nLast = i;
+        while (nLast + 1 < n && rDelayed[nLast + 1].mCol == rFirst.mCol
+                && rDelayed[nLast + 1].mRow == rDelayed[nLast].mRow + 1
+                && rDelayed[nLast + 1].mnNumberFormat == rFirst.mnNumberFormat)
+            ++nLast;
+
+        if (nLast == i)
+            SetNumberFormat( ScAddress( rFirst.mCol, rFirst.mRow, nTab ), rFirst.mnNumberFormat );
+        else
+        {
+            ScPatternAttr aPattern( GetPool() );
+            aPattern.GetItemSet().Put( SfxUInt32Item( ATTR_VALUE_FORMAT, rFirst.mnNumberFormat ) );
+            ApplyPatternAreaTab( rFirst.mCol, rFirst.mRow, rFirst.mCol, rDelayed[nLast].mRow, nTab, aPattern );
+        }
+        i = nLast + 1;
+    }
+    rDelayed.clear();
 
     ScTable* pTab = FetchTable(nTab);
     if (!pTab)
@@ -31,8 +31,6 @@
 #include <table.hxx>
 #include <attrib.hxx>
 #include <attarray.hxx>
-#include <markarr.hxx>
-#include <markdata.hxx>
 #include <patattr.hxx>
 #include <poolhelp.hxx>
 #include <docpool.hxx>
@@ -353,8 +351,7 @@ bool handleConditionalFormat(ScConditionalFormatList& rCondFormList, const ScCon
 
 void ScDocument::FillInfo(
     ScTableInfo& rTabInfo, SCCOL nCol1, SCROW nRow1, SCCOL nCol2, SCROW nRow2,
-    SCTAB nTab, double fColScale, double fRowScale, bool bPageMode, bool bFormulaMode,
-    const ScMarkData* pMarkData )
+    SCTAB nTab, double fColScale, double fRowScale, bool bPageMode, bool bFormulaMode )
 {
     OSL_ENSURE( maTabs[nTab], "Table does not exist" );
 
@@ -455,7 +452,7 @@ void ScDocument::FillInfo(
                 else
                     pThisAttrArr = &maTabs[nTab]->aDefaultColData.AttrArray();
 
-                if (nCol+1 >= nCol1)                                // Attribute/Blockmark from nX1-1
+                if (nCol+1 >= nCol1)                                // Attribute from nX1-1
                 {
                     nArrRow = 0;
 
@@ -588,34 +585,6 @@ void ScDocument::FillInfo(
                         ++nIndex;
                     }
                     while ( nIndex < pThisAttrArr->Count() && nThisRow < nYExtra );
-
-                    if (pMarkData && pMarkData->IsMultiMarked())
-                    {
-                        //  Block marks
-                        ScMarkArray aThisMarkArr(pMarkData->GetMarkArray( nCol ));
-                        nArrRow = 1;
-                        nCurRow = nRow1;                                      // single rows
-
-                        if ( aThisMarkArr.Search( nRow1, nIndex ) )
-                        {
-                            do
-                            {
-                                nThisRow=aThisMarkArr.mvData[nIndex].nRow;      // End of range
-
-                                do
-                                {
-                                    if ( !RowHidden( nCurRow,nTab ) )
-                                    {
-                                        ++nArrRow;
-                                    }
-                                    ++nCurRow;
-                                }
-                                while (nCurRow <= nThisRow && nCurRow <= nRow2);
-                                ++nIndex;
-                            }
-                            while ( nIndex < aThisMarkArr.mvData.size() && nThisRow < nRow2 );
-                        }
-                    }
                 }
                 else                                    // columns in front
                 {
@@ -25,6 +25,7 @@
 
 #include <cassert>
 #include <cstdlib>
+#include <optional>
 
 #include <formulacell.hxx>
 #include <grouptokenconverter.hxx>
@@ -1244,6 +1245,26 @@ void ScFormulaCell::CompileTokenArray( sc::CompileFormulaContext& rCxt, bool bNo
     }
 }
 
+namespace {
+
+/** Whether rCode, written out at rPos, gives the imported formula string
+    rFormula, i.e. whether compiling rFormula would produce rCode again. */
+bool lcl_isSameFormula( sc::CompileFormulaContext& rCxt, const ScAddress& rPos,
+        ScTokenArray& rCode, const OUString& rFormula )
+{
+    ScCompiler aBackComp( rCxt, rPos, rCode );
+    OUStringBuffer aShouldBeBuf;
+    aBackComp.CreateStringFromTokenArray( aShouldBeBuf );
+
+    // The initial '=' is optional in ODFF.
+    const sal_Int32 nLeadingEqual = (rFormula.getLength() > 0 && rFormula[0] == '=') ? 1 : 0;
+    OUString aShouldBe = aShouldBeBuf.makeStringAndClear();
+    return rFormula.getLength() == aShouldBe.getLength() + nLeadingEqual &&
+        rFormula.match( aShouldBe, nLeadingEqual);
+}
+
+}
+
 void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rProgress )
 {
     if ( cMatrixFlag == ScMatrixMode::Reference )
@@ -1282,15 +1303,7 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
         {
             // Build formula string using the tokens from the previous cell,
             // but use the current cell position.
-            ScCompiler aBackComp( rCxt, aPos, *(pPreviousCell->pCode) );
-            OUStringBuffer aShouldBeBuf;
-            aBackComp.CreateStringFromTokenArray( aShouldBeBuf );
-
-            // The initial '=' is optional in ODFF.
-            const sal_Int32 nLeadingEqual = (aFormula.getLength() > 0 && aFormula[0] == '=') ? 1 : 0;
-            OUString aShouldBe = aShouldBeBuf.makeStringAndClear();
-            if (aFormula.getLength() == aShouldBe.getLength() + nLeadingEqual &&
-                    aFormula.match( aShouldBe, nLeadingEqual))
+            if (lcl_isSameFormula( rCxt, aPos, *(pPreviousCell->pCode), aFormula ))
             {
                 // Put them in the same formula group.
                 ScFormulaCellGroupRef xGroup = pPreviousCell->GetCellGroup();
@@ -1317,6 +1330,35 @@ void ScFormulaCell::CompileXML( sc::CompileFormulaContext& rCxt, ScProgress& rPr
         }
     }
 
+    if ( bDoCompile && !mxGroup && aFormulaNmsp.isEmpty() && cMatrixFlag == ScMatrixMode::NONE )
+    {
+        // Formulas filled across a row can't be grouped, but the left
+        // neighbour is compiled already (columns are done in order), and if
+        // it yields the same string here its code can be copied instead of
+        // parsing the string again.
+        ScAddress aLeftCell( aPos );
+        aLeftCell.IncCol( -1 );
+        ScFormulaCell *pLeftCell = rDocument.GetFormulaCell( aLeftCell );
+        if (pLeftCell && !pLeftCell->bCompile && !pLeftCell->mbIsExtRef
+                && pLeftCell->cMatrixFlag == ScMatrixMode::NONE
+                && pLeftCell->GetCode()->GetCodeError() == FormulaError::NONE
+                && pLeftCell->GetCode()->IsShareable()
+                && lcl_isSameFormula( rCxt, aPos, *(pLeftCell->pCode), aFormula ))
+        {
+            nFormatType = pLeftCell->nFormatType;
+            bSubTotal = pLeftCell->bSubTotal;
+            bChanged = true;
+            bCompile = false;
+
+            if (bSubTotal)
+                rDocument.AddSubTotalCell(this);
+
+            bDoCompile = false;
+            delete pCode;
+            pCode = pLeftCell->pCode->Clone().release();
+        }
+    }
+
     if (bDoCompile)
     {
         ScTokenArray* pCodeOld = pCode;
@@ -1720,6 +1762,9 @@ bool ScFormulaCell::Interpret(SCROW nStartOffset, SCROW nEndOffset)
                 {
                     rDone = false;
                     bool bFirst = true;
+                    // One context for the whole sweep instead of fetching
+                    // and cleaning up one for each cell of the circle.
+                    std::optional<ScInterpreterContextGetterGuard> oContextGetterGuard;
                     for ( ScFormulaRecursionList::iterator aIter(
                                 rRecursionHelper.GetIterationStart()); aIter !=
                             rRecursionHelper.GetIterationEnd() &&
@@ -1731,9 +1776,10 @@ bool ScFormulaCell::Interpret(SCROW nStartOffset, SCROW nEndOffset)
                                 pIterCell->GetSeenInIteration())
                         {
                             (*aIter).aPreviousResult = pIterCell->aResult;
+                            if (!oContextGetterGuard)
+                                oContextGetterGuard.emplace(rDocument, rDocument.GetFormatTable());
                             rDocument.IncInterpretLevel();
-                            ScInterpreterContextGetterGuard aContextGetterGuard(rDocument, rDocument.GetFormatTable());
-                            pIterCell->InterpretTail( *aContextGetterGuard.GetInterpreterContext(), SCITP_FROM_ITERATION);
+                            pIterCell->InterpretTail( *oContextGetterGuard->GetInterpreterContext(), SCITP_FROM_ITERATION);
                             rDocument.DecInterpretLevel();
                         }
                         if (bFirst)
@@ -986,7 +986,10 @@ void ScPostIt::ForgetCaption( bool bPreserveData )
 
 void ScPostIt::ShowCaption( const ScAddress& rPos, bool bShow )
 {
-    CreateCaptionFromInitData( rPos );
+    // A hidden note without caption object keeps its initial data; the
+    // caption is created when it gets shown or edited.
+    if( bShow || maNoteData.mxCaption )
+        CreateCaptionFromInitData( rPos );
     // no separate drawing undo needed, handled completely inside ScUndoShowHideNote
     maNoteData.mbShown = bShow;
     if( maNoteData.mxCaption )
@@ -995,14 +998,17 @@ void ScPostIt::ShowCaption( const ScAddress& rPos, bool bShow )
 
 void ScPostIt::ShowCaptionTemp( const ScAddress& rPos, bool bShow )
 {
-    CreateCaptionFromInitData( rPos );
+    if( bShow || maNoteData.mbShown || maNoteData.mxCaption )
+        CreateCaptionFromInitData( rPos );
     if( maNoteData.mxCaption )
         ScCaptionUtil::SetCaptionLayer( *maNoteData.mxCaption, maNoteData.mbShown || bShow );
 }
 
 void ScPostIt::UpdateCaptionPos( const ScAddress& rPos )
 {
-    CreateCaptionFromInitData( rPos );
+    /*  Don't create the caption just to move it, e.g. for every note of a
+        sorted range. Initial data is placed relative to the cell when the
+        caption gets created. */
     if( maNoteData.mxCaption )
     {
         ScCaptionCreator aCreator( mrDoc, rPos, maNoteData.mxCaption );
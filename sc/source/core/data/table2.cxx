@@ -2884,6 +2884,9 @@ void ScTable::ApplyPatternArea( SCCOL nStartCol, SCROW nStartRow, SCCOL nEndCol,
         return;
     PutInOrder(nStartCol, nEndCol);
     PutInOrder(nStartRow, nEndRow);
+    // One cache for all columns, so that each distinct old pattern is merged with rAttr
+    // and put into the pool only once, not once per column.
+    SfxItemPoolCache aCache( GetDoc().GetPool(), &rAttr.GetItemSet() );
     SCCOL maxCol = nEndCol;
     if( nEndCol == GetDoc().MaxCol())
     {
@@ -2891,10 +2894,10 @@ void ScTable::ApplyPatternArea( SCCOL nStartCol, SCROW nStartRow, SCCOL nEndCol,
         maxCol = std::max( nStartCol, aCol.size()) - 1;
         if( maxCol >= 0 )
             CreateColumnIfNotExists(maxCol); // Allocate needed different columns before changing the default.
-        aDefaultColData.ApplyPatternArea(nStartRow, nEndRow, rAttr, pDataArray, pIsChanged);
+        aDefaultColData.ApplyCacheArea(nStartRow, nEndRow, &aCache, pDataArray, pIsChanged);
     }
     for (SCCOL i = nStartCol; i <= maxCol; i++)
-        CreateColumnIfNotExists(i).ApplyPatternArea(nStartRow, nEndRow, rAttr, pDataArray, pIsChanged);
+        CreateColumnIfNotExists(i).ApplyCacheArea(nStartRow, nEndRow, &aCache, pDataArray, pIsChanged);
 }
 
 void ScTable::SetAttrEntries( SCCOL nStartCol, SCCOL nEndCol, std::vector<ScAttrEntry> && vNewData)
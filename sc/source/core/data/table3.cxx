@@ -63,6 +63,7 @@
 #include <drwlayer.hxx>
 #include <queryevaluator.hxx>
 #include <scopetools.hxx>
+#include <collationkeycache.hxx>
 
 #include <svl/sharedstringpool.hxx>
 
@@ -639,6 +640,15 @@ void ScTable::InitSortCollator( const ScSortParam& rPar )
         DestroySortCollator();
         pSortCollator = &ScGlobal::GetCollator(rPar.bCaseSens);
     }
+
+    // Sort keys stay valid for as long as the same collator is used, also
+    // across several sorts.
+    const css::lang::Locale& rLocale = rPar.aCollatorLocale;
+    OUString aSignature = rLocale.Language + "-" + rLocale.Country + "-" + rLocale.Variant
+        + "\t" + rPar.aCollatorAlgorithm;
+    if (rPar.bCaseSens)
+        aSignature += "\tcase";
+    rDocument.GetCollationKeyCache().setCollator(*pSortCollator, aSignature);
 }
 
 void ScTable::DestroySortCollator()
@@ -1602,6 +1612,9 @@ short ScTable::CompareCell(
                 {
                     if ( bNaturalSort )
                         nRes = naturalsort::Compare( aStr1, aStr2, bCaseSens, nullptr, pSortCollator );
+                    else if (eType1 == CELLTYPE_STRING && eType2 == CELLTYPE_STRING)
+                        nRes = static_cast<short>( rDocument.GetCollationKeyCache().compare(
+                                    *rCell1.getSharedString(), *rCell2.getSharedString() ) );
                     else
                         nRes = static_cast<short>( pSortCollator->compareString( aStr1, aStr2 ) );
                 }
@@ -3972,28 +3972,29 @@ void DynamicKernel::CreateKernel()
     openclwrapper::KernelEnv kEnv;
     openclwrapper::setKernelEnv(&kEnv);
     const char* src = mFullProgramSrc.c_str();
-    static std::string lastOneKernelHash;
-    static std::string lastSecondKernelHash;
-    static cl_program lastOneProgram = nullptr;
-    static cl_program lastSecondProgram = nullptr;
+    // Most recently used programs first. Documents usually have more than
+    // a couple of distinct formula groups, and loading a binary back from
+    // the disk cache for every switch between them is not cheap either.
+    static std::vector<std::pair<std::string, cl_program>> aProgramCache;
+    constexpr size_t nProgramCacheSize = 16;
     std::string KernelHash = mKernelSignature + GetMD5();
-    if (lastOneKernelHash == KernelHash && lastOneProgram)
+    auto itCached = std::find_if(aProgramCache.begin(), aProgramCache.end(),
+        [&KernelHash](const std::pair<std::string, cl_program>& rEntry) { return rEntry.first == KernelHash; });
+    if (itCached != aProgramCache.end())
     {
-        mpProgram = lastOneProgram;
-    }
-    else if (lastSecondKernelHash == KernelHash && lastSecondProgram)
-    {
-        mpProgram = lastSecondProgram;
+        mpProgram = itCached->second;
+        std::rotate(aProgramCache.begin(), itCached, itCached + 1);
     }
     else
-    {   // doesn't match the last compiled formula.
+    {   // not compiled in this session, or evicted since.
 
-        if (lastSecondProgram)
+        if (aProgramCache.size() >= nProgramCacheSize)
         {
-            SAL_INFO("sc.opencl", "Releasing program " << lastSecondProgram);
-            err = clReleaseProgram(lastSecondProgram);
+            cl_program pOldProgram = aProgramCache.back().second;
+            SAL_INFO("sc.opencl", "Releasing program " << pOldProgram);
+            err = clReleaseProgram(pOldProgram);
             SAL_WARN_IF(err != CL_SUCCESS, "sc.opencl", "clReleaseProgram failed: " << openclwrapper::errorString(err));
-            lastSecondProgram = nullptr;
+            aProgramCache.pop_back();
         }
         if (openclwrapper::buildProgramFromBinary("",
                 &openclwrapper::gpuEnv, KernelHash.c_str(), 0))
@@ -4070,10 +4071,7 @@ void DynamicKernel::CreateKernel()
             openclwrapper::generatBinFromKernelSource(mpProgram,
                 (mKernelSignature + GetMD5()).c_str());
         }
-        lastSecondKernelHash = lastOneKernelHash;
-        lastSecondProgram = lastOneProgram;
-        lastOneKernelHash = KernelHash;
-        lastOneProgram = mpProgram;
+        aProgramCache.emplace(aProgramCache.begin(), KernelHash, mpProgram);
     }
     mpKernel = clCreateKernel(mpProgram, kname.c_str(), &err);
     if (err != CL_SUCCESS)
@@ -0,0 +1,91 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <collationkeycache.hxx>
+
+#include <svl/sharedstring.hxx>
+#include <unotools/collatorwrapper.hxx>
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+
+namespace
+{
+/// Upper bound of cached keys, to keep the memory of huge sorts in check.
+constexpr size_t nMaxCachedKeys = 4 * 1024 * 1024;
+}
+
+ScCollationKeyCache::ScCollationKeyCache()
+    : mpCollator(nullptr)
+    , mbKeysAvailable(true)
+{
+}
+
+ScCollationKeyCache::~ScCollationKeyCache() {}
+
+void ScCollationKeyCache::setCollator(const CollatorWrapper& rCollator, const OUString& rSignature)
+{
+    mpCollator = &rCollator;
+    if (rSignature == maCollatorSignature)
+        return;
+
+    clear();
+    maCollatorSignature = rSignature;
+}
+
+void ScCollationKeyCache::clear()
+{
+    maKeys.clear();
+    mbKeysAvailable = true;
+}
+
+css::uno::Sequence<sal_Int8> ScCollationKeyCache::getKey(const svl::SharedString& rStr)
+{
+    auto it = maKeys.find(rStr.getData());
+    if (it != maKeys.end())
+        return it->second.maKey;
+
+    if (maKeys.size() >= nMaxCachedKeys)
+        maKeys.clear();
+
+    const OUString& rString = rStr.getString();
+    Entry aEntry{ rString, mpCollator->getSortKey(rString) };
+    return maKeys.emplace(rStr.getData(), std::move(aEntry)).first->second.maKey;
+}
+
+sal_Int32 ScCollationKeyCache::compare(const svl::SharedString& rStr1,
+                                       const svl::SharedString& rStr2)
+{
+    assert(mpCollator && "ScCollationKeyCache: no collator set");
+
+    if (rStr1.getData() == rStr2.getData())
+        return 0;
+
+    if (mbKeysAvailable)
+    {
+        const css::uno::Sequence<sal_Int8> aKey1 = getKey(rStr1);
+        const css::uno::Sequence<sal_Int8> aKey2 = getKey(rStr2);
+        if (aKey1.hasElements() && aKey2.hasElements())
+        {
+            const sal_Int32 nLen = std::min(aKey1.getLength(), aKey2.getLength());
+            int nRes = memcmp(aKey1.getConstArray(), aKey2.getConstArray(), nLen);
+            if (nRes == 0)
+                nRes = aKey1.getLength() - aKey2.getLength();
+            return nRes < 0 ? -1 : (nRes > 0 ? 1 : 0);
+        }
+        // The collator does not provide keys, don't bother asking again.
+        mbKeysAvailable = false;
+        maKeys.clear();
+    }
+
+    return mpCollator->compareString(rStr1.getString(), rStr2.getString());
+}
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
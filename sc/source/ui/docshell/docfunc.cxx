@@ -1304,7 +1304,8 @@ bool ScDocFunc::ShowNote( const ScAddress& rPos, bool bShow )
 
     if (ScViewData* pViewData = ScDocShell::GetViewData())
     {
-        if (ScDrawView* pDrawView = pViewData->GetScDrawView())
+        ScDrawView* pDrawView = pViewData->GetScDrawView();
+        if (pDrawView && pNote->GetCaption())
             pDrawView->SyncForGrid( pNote->GetCaption());
     }
 
@@ -550,8 +550,7 @@ void ScGridWindow::Draw( SCCOL nX1, SCROW nY1, SCCOL nX2, SCROW nY2, ScUpdateMod
 
     ScTableInfo aTabInfo;
     rDoc.FillInfo( aTabInfo, nX1, nY1, nX2, nY2, nTab,
-                   nPPTX, nPPTY, false, rOpts.GetOption(VOPT_FORMULAS),
-                   &mrViewData.GetMarkData() );
+                   nPPTX, nPPTY, false, rOpts.GetOption(VOPT_FORMULAS) );
 
     Fraction aZoomX = mrViewData.GetZoomX();
     Fraction aZoomY = mrViewData.GetZoomY();
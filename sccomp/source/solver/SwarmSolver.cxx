@@ -30,6 +30,8 @@
 #include <comphelper/proparrhlp.hxx>
 
 #include <cmath>
+#include <map>
+#include <tuple>
 #include <vector>
 #include <limits>
 #include <chrono>
@@ -129,6 +131,12 @@ private:
     std::vector<Bound> maBounds;
     std::vector<sheet::SolverConstraint> maNonBoundedConstraints;
 
+    // every cell lookup is three UNO calls, so resolve each cell only once per solve
+    std::map<std::tuple<sal_Int16, sal_Int32, sal_Int32>, uno::Reference<table::XCell>> maCells;
+    // values last written to the variable cells; writing an unchanged value would still
+    // dirty everything that depends on it
+    std::vector<double> maAppliedValues;
+
 private:
     static OUString getResourceString(TranslateId aId);
 
@@ -293,10 +301,17 @@ OUString SwarmSolver::getResourceString(TranslateId aId)
 
 uno::Reference<table::XCell> SwarmSolver::getCell(const table::CellAddress& rPosition)
 {
-    uno::Reference<container::XIndexAccess> xSheets(mxDocument->getSheets(), uno::UNO_QUERY);
-    uno::Reference<sheet::XSpreadsheet> xSheet(xSheets->getByIndex(rPosition.Sheet),
-                                               uno::UNO_QUERY);
-    return xSheet->getCellByPosition(rPosition.Column, rPosition.Row);
+    uno::Reference<table::XCell>& rxCell
+        = maCells[std::make_tuple(rPosition.Sheet, rPosition.Column, rPosition.Row)];
+    if (!rxCell.is())
+    {
+        uno::Reference<container::XIndexAccess> xSheets(mxDocument->getSheets(),
+                                                        uno::UNO_QUERY);
+        uno::Reference<sheet::XSpreadsheet> xSheet(xSheets->getByIndex(rPosition.Sheet),
+                                                   uno::UNO_QUERY);
+        rxCell = xSheet->getCellByPosition(rPosition.Column, rPosition.Row);
+    }
+    return rxCell;
 }
 
 void SwarmSolver::setValue(const table::CellAddress& rPosition, double fValue)
@@ -316,7 +331,10 @@ void SwarmSolver::applyVariables(std::vector<double> const& rVariables)
 {
     for (sal_Int32 i = 0; i < maVariables.getLength(); ++i)
     {
+        if (maAppliedValues[i] == rVariables[i])
+            continue;
         setValue(maVariables[i], rVariables[i]);
+        maAppliedValues[i] = rVariables[i];
     }
 }
 
@@ -511,7 +529,10 @@ void SAL_CALL SwarmSolver::solve()
     if (!maVariables.getLength())
         return;
 
-    maBounds.resize(maVariables.getLength());
+    maBounds.assign(maVariables.getLength(), Bound());
+    maNonBoundedConstraints.clear();
+    maCells.clear();
+    maAppliedValues.assign(maVariables.getLength(), std::numeric_limits<double>::quiet_NaN());
 
     xModel->lockControllers();
 
@@ -9,7 +9,12 @@
 
 #include <swmodeltestbase.hxx>
 
+#include <com/sun/star/lang/XMultiServiceFactory.hpp>
 #include <com/sun/star/text/XTextFrame.hpp>
+#include <com/sun/star/text/XTextDocument.hpp>
+#include <com/sun/star/text/XTextTable.hpp>
+#include <com/sun/star/text/XTextTableCursor.hpp>
+#include <com/sun/star/table/XTableRows.hpp>
 #include <com/sun/star/linguistic2/XHyphenator.hpp>
 
 #include <comphelper/scopeguard.hxx>
@@ -18,6 +23,7 @@
 #include <unotools/syslocaleoptions.hxx>
 #include <editeng/unolingu.hxx>
 #include <o3tl/string_view.hxx>
+#include <rtl/ustrbuf.hxx>
 
 #include <unotxdoc.hxx>
 #include <rootfrm.hxx>
@@ -36,6 +42,8 @@ class SwLayoutWriter2 : public SwModelTestBase
 {
 protected:
     void CheckRedlineCharAttributesHidden();
+    /// Creates a document with an 18 cm high page body and a table at its start.
+    uno::Reference<text::XTextTable> createDocWithTable(sal_Int32 nRows, sal_Int32 nColumns);
 };
 
 // this mainly tests that splitting portions across redlines in SwAttrIter works
@@ -140,6 +148,26 @@ CPPUNIT_TEST_FIXTURE(SwLayoutWriter2, testTdf100680_as_char_wrap)
     // If the third line missing that assert will fire, as was before the fix.
 }
 
+uno::Reference<text::XTextTable> SwLayoutWriter2::createDocWithTable(sal_Int32 nRows,
+                                                                      sal_Int32 nColumns)
+{
+    createSwDoc();
+    uno::Reference<beans::XPropertySet> xPageStyle(getStyles("PageStyles")->getByName("Standard"),
+                                                   uno::UNO_QUERY);
+    xPageStyle->setPropertyValue("Height", uno::Any(sal_Int32(20000)));
+    xPageStyle->setPropertyValue("TopMargin", uno::Any(sal_Int32(1000)));
+    xPageStyle->setPropertyValue("BottomMargin", uno::Any(sal_Int32(1000)));
+
+    uno::Reference<lang::XMultiServiceFactory> xFactory(mxComponent, uno::UNO_QUERY);
+    uno::Reference<text::XTextTable> xTable(
+        xFactory->createInstance("com.sun.star.text.TextTable"), uno::UNO_QUERY);
+    xTable->initialize(nRows, nColumns);
+    uno::Reference<text::XTextDocument> xTextDocument(mxComponent, uno::UNO_QUERY);
+    uno::Reference<text::XText> xText = xTextDocument->getText();
+    xText->insertTextContent(xText->createTextCursor(), xTable, false);
+    return xTable;
+}
+
 CPPUNIT_TEST_FIXTURE(SwLayoutWriter2, testRedlineCharAttributes)
 {
     createSwDoc(DATA_DIRECTORY, "redline_charatr.fodt");
@@ -2267,6 +2295,111 @@ CPPUNIT_TEST_FIXTURE(SwLayoutWriter2, testTdf124261)
 #endif
 }
 
+CPPUNIT_TEST_FIXTURE(SwLayoutWriter2, testTableSplitKeepFirstRow)
+{
+    // A repeated heading row and a first row that must not be split, which together are higher
+    // than the page: the first row is kept in the master and the table is split at the row after
+    // it, which only gets formatted when the split decides to use it.
+    uno::Reference<text::XTextTable> xTable = createDocWithTable(5, 2);
+    uno::Reference<beans::XPropertySet> xTableProps(xTable, uno::UNO_QUERY);
+    xTableProps->setPropertyValue("RepeatHeadline", uno::Any(true));
+    xTableProps->setPropertyValue("HeaderRowCount", uno::Any(sal_Int32(1)));
+
+    uno::Reference<table::XTableRows> xRows = xTable->getRows();
+    uno::Reference<beans::XPropertySet> xRow(xRows->getByIndex(0), uno::UNO_QUERY);
+    xRow->setPropertyValue("IsAutoHeight", uno::Any(false));
+    xRow->setPropertyValue("Height", uno::Any(sal_Int32(3000)));
+    xRow.set(xRows->getByIndex(1), uno::UNO_QUERY);
+    xRow->setPropertyValue("IsAutoHeight", uno::Any(false));
+    xRow->setPropertyValue("Height", uno::Any(sal_Int32(16000)));
+    xRow->setPropertyValue("IsSplitAllowed", uno::Any(false));
+
+    uno::Reference<text::XText>(xTable->getCellByName("A1"), uno::UNO_QUERY)->setString("heading");
+    uno::Reference<text::XText>(xTable->getCellByName("A2"), uno::UNO_QUERY)->setString("kept");
+    // A row that is higher than a page, so it is split again in the follow.
+    OUStringBuffer aLines("line 1");
+    for (int i = 2; i <= 60; ++i)
+        aLines.append("\rline " + OUString::number(i));
+    uno::Reference<text::XText>(xTable->getCellByName("A3"), uno::UNO_QUERY)
+        ->setString(aLines.makeStringAndClear());
+    uno::Reference<text::XText>(xTable->getCellByName("A4"), uno::UNO_QUERY)->setString("row 4");
+    uno::Reference<text::XText>(xTable->getCellByName("A5"), uno::UNO_QUERY)->setString("row 5");
+
+    calcLayout();
+    xmlDocUniquePtr pXmlDoc = parseLayoutDump();
+
+    // The heading and the kept row stay on the first page.
+    assertXPath(pXmlDoc, "/root/page[1]/body/tab/row", 2);
+    assertXPath(pXmlDoc, "/root/page[1]/body/tab/row[2]/cell[1]/txt[1]/SwParaPortion/SwLineLayout",
+                "portion", "kept");
+    CPPUNIT_ASSERT(!getXPath(pXmlDoc, "/root/page[1]/body/tab", "follow").isEmpty());
+
+    // The follow starts with the repeated heading and the complete start of the next row, which
+    // is split once more.
+    assertXPath(pXmlDoc, "/root/page[2]/body/tab/row[1]/cell[1]/txt[1]/SwParaPortion/SwLineLayout",
+                "portion", "heading");
+    assertXPath(pXmlDoc,
+                "/root/page[2]/body/tab/row[2]/cell[1]/txt[1]/SwParaPortion/SwLineLayout",
+                "portion", "line 1");
+    CPPUNIT_ASSERT(!getXPath(pXmlDoc, "/root/page[2]/body/tab/row[2]/cell[1]", "follow").isEmpty());
+
+    // Every line and the rows after the split one are laid out exactly once.
+    for (int i = 1; i <= 60; ++i)
+    {
+        OString aXPath = "//tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='line "
+                         + OString::number(i) + "']";
+        assertXPath(pXmlDoc, aXPath, 1);
+    }
+    assertXPath(pXmlDoc, "//tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='row 4']", 1);
+    assertXPath(pXmlDoc, "//tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='row 5']", 1);
+}
+
+CPPUNIT_TEST_FIXTURE(SwLayoutWriter2, testTableSplitRowSpanOverCut)
+{
+    // 30 rows of 1 cm on pages with an 18 cm high body, and a cell spanning rows 10 to 25, so
+    // the cut of the table goes through the row span.
+    uno::Reference<text::XTextTable> xTable = createDocWithTable(30, 2);
+    uno::Reference<table::XTableRows> xRows = xTable->getRows();
+    for (sal_Int32 i = 0; i < 30; ++i)
+    {
+        uno::Reference<beans::XPropertySet> xRow(xRows->getByIndex(i), uno::UNO_QUERY);
+        xRow->setPropertyValue("IsAutoHeight", uno::Any(false));
+        xRow->setPropertyValue("Height", uno::Any(sal_Int32(1000)));
+        uno::Reference<text::XText>(xTable->getCellByName("B" + OUString::number(i + 1)),
+                                    uno::UNO_QUERY)
+            ->setString("row " + OUString::number(i + 1));
+    }
+    uno::Reference<text::XTextTableCursor> xCursor = xTable->createCursorByCellName("A10");
+    xCursor->gotoCellByName("A25", /*bExpand=*/true);
+    xCursor->mergeRange();
+    uno::Reference<text::XText>(xTable->getCellByName("A10"), uno::UNO_QUERY)->setString("merged");
+
+    calcLayout();
+    xmlDocUniquePtr pXmlDoc = parseLayoutDump();
+
+    CPPUNIT_ASSERT_EQUAL(2, getPages());
+    CPPUNIT_ASSERT(!getXPath(pXmlDoc, "/root/page[1]/body/tab", "follow").isEmpty());
+    CPPUNIT_ASSERT(!getXPath(pXmlDoc, "/root/page[2]/body/tab", "precede").isEmpty());
+
+    // The spanning cell starts on the first page, and no row is lost or laid out twice.
+    assertXPath(pXmlDoc,
+                "/root/page[1]/body/tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='merged']",
+                1);
+    assertXPath(pXmlDoc, "//tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='merged']", 1);
+    assertXPath(pXmlDoc,
+                "/root/page[1]/body/tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='row 1']",
+                1);
+    assertXPath(pXmlDoc,
+                "/root/page[2]/body/tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='row 30']",
+                1);
+    for (int i = 1; i <= 30; ++i)
+    {
+        OString aXPath = "//tab/row/cell/txt/SwParaPortion/SwLineLayout[@portion='row "
+                         + OString::number(i) + "']";
+        assertXPath(pXmlDoc, aXPath, 1);
+    }
+}
+
 CPPUNIT_PLUGIN_IMPLEMENT();
 
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
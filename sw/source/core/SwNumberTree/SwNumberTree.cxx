@@ -614,6 +614,13 @@ void SwNumberTreeNode::RemoveChild(SwNumberTreeNode* pChild, const SwDoc& rDoc)
             pRemove->MoveChildren(*aItPred);
             (*aItPred)->InvalidateTree();
             (*aItPred)->NotifyInvalidChildren(rDoc);
+
+            // a next not counted node continues the numbering of the
+            // predecessor's last child, which just changed.
+            tSwNumberTreeChildren::const_iterator aItNext = aRemoveIt;
+            ++aItNext;
+            if (aItNext != mChildren.end() && !(*aItNext)->IsCounted())
+                (*aItNext)->InvalidateChildren();
         }
 
         // #i60652#
@@ -979,8 +986,14 @@ void SwNumberTreeNode::SetLastValid
         )
     {
         mItLastValid = aItValid;
-        // invalidation of children of next not counted is needed
-        if ( GetParent() )
+        // invalidation of children of next not counted is needed.
+        // These continue the numbering of our last child, so validating
+        // only the children before it doesn't affect them. Otherwise
+        // alternating number requests for the two sets of children would
+        // renumber the following one from its start each time.
+        if ( GetParent() &&
+             ( !bValidating || aItValid == mChildren.end() ||
+               *aItValid == *mChildren.rbegin() ) )
         {
             tSwNumberTreeChildren::const_iterator aParentChildIt =
                                             GetParent()->GetIterator( this );
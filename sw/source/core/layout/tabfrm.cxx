@@ -185,9 +185,13 @@ static void lcl_RecalcRow( SwRowFrame& rRow, tools::Long nBottom );
 static bool lcl_ArrangeLowers( SwLayoutFrame *pLay, tools::Long lYStart, bool bInva );
 // #i26945# - add parameter <_bOnlyRowsAndCells> to control
 // that only row and cell frames are formatted.
+// <_nStopBottom> ends the loop over <pFrame> and its next siblings after the
+// first one extending below it; their lowers are still formatted
+// according to <nBottom>.
 static bool lcl_InnerCalcLayout( SwFrame *pFrame,
                                       tools::Long nBottom,
-                                      bool _bOnlyRowsAndCells = false );
+                                      bool _bOnlyRowsAndCells = false,
+                                      tools::Long _nStopBottom = LONG_MAX );
 // OD 2004-02-18 #106629# - correct type of 1st parameter
 // #i26945# - add parameter <_bConsiderObjs> in order to
 // control, if floating screen objects have to be considered for the minimal
@@ -1029,7 +1033,10 @@ bool SwTabFrame::Split( const SwTwips nCutPos, bool bTryToSplit, bool bTableRowK
         Lower()->InvalidatePos_();
         // #i43913# - correction
         // call method <lcl_InnerCalcLayout> with first lower.
-        lcl_InnerCalcLayout( Lower(), LONG_MAX, true );
+        // Rows below the one crossing the cut position are moved to the
+        // follow and formatted there. Formatting them here as well would
+        // make splitting a long table over many pages quadratic.
+        lcl_InnerCalcLayout( Lower(), LONG_MAX, true, nCutPos );
     }
 
     //In order to be able to compare the positions of the cells with CutPos,
@@ -1140,6 +1147,12 @@ bool SwTabFrame::Split( const SwTwips nCutPos, bool bTryToSplit, bool bTableRowK
         {
             pRow = static_cast<SwRowFrame*>(pRow->GetNext());
             ++nRowCount;
+            // The lcl_InnerCalcLayout call above stopped at the row crossing
+            // the cut position. pRow lies behind it and may still be split
+            // below, so format it now; as it starts below the cut position,
+            // none of its next siblings are formatted.
+            if ( pRow )
+                lcl_InnerCalcLayout( pRow, LONG_MAX, true, nCutPos );
         }
     }
 
@@ -1603,7 +1616,8 @@ bool SwContentFrame::CalcLowers(SwLayoutFrame & rLay, SwLayoutFrame const& rDont
 // that only row and cell frames are formatted.
 static bool lcl_InnerCalcLayout( SwFrame *pFrame,
                                       tools::Long nBottom,
-                                      bool _bOnlyRowsAndCells )
+                                      bool _bOnlyRowsAndCells,
+                                      tools::Long _nStopBottom )
 {
     vcl::RenderContext* pRenderContext = pFrame->getRootFrame()->GetCurrShell() ? pFrame->getRootFrame()->GetCurrShell()->GetOut() : nullptr;
     // LONG_MAX == nBottom means we have to calculate all
@@ -1642,6 +1656,9 @@ static bool lcl_InnerCalcLayout( SwFrame *pFrame,
                 }
             }
         }
+        if ( LONG_MAX != _nStopBottom &&
+             aRectFnSet.YDiff(aRectFnSet.GetBottom(pFrame->getFrameArea()), _nStopBottom) > 0 )
+            break;
         pFrame = pFrame->GetNext();
     } while( pFrame &&
             ( bAll ||
@@ -0,0 +1,168 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ */
+
+#include <test/bootstrapfixture.hxx>
+#include <cppunit/plugin/TestPlugIn.h>
+#include <rtl/ref.hxx>
+#include <tools/stream.hxx>
+#include <unotools/tempfile.hxx>
+#include <filinpstr.hxx>
+
+#include <algorithm>
+#include <vector>
+
+using namespace css;
+using namespace fileaccess;
+
+namespace
+{
+
+    // larger than the read-ahead buffer of XInputStream_impl, so that the
+    // tests below can move both inside and outside of it
+    constexpr sal_Int32 FILE_SIZE = 1024 * 1024;
+
+    sal_Int8 patternAt( sal_Int64 nPos )
+    {
+        return static_cast< sal_Int8 >( ( nPos * 7 ) ^ ( nPos >> 8 ) );
+    }
+
+    class file_inputstream_test: public test::BootstrapFixture
+    {
+        utl::TempFile m_aTempFile;
+
+        // read nBytes from the current position and compare them with the
+        // pattern, then check that the position moved accordingly
+        static void checkRead( const rtl::Reference< XInputStream_impl >& xStream,
+                               sal_Int64& rPos, sal_Int32 nBytes );
+
+    public:
+        file_inputstream_test() : BootstrapFixture( true, true ) {}
+
+        // initialise your test code values here.
+        void setUp() override;
+
+        void tearDown() override;
+
+        void ReadAheadSeekAndSkip();
+
+        // Change the following lines only, if you add, remove or rename
+        // member functions of the current class,
+        // because these macros are need by auto register mechanism.
+
+        CPPUNIT_TEST_SUITE( file_inputstream_test );
+        CPPUNIT_TEST( ReadAheadSeekAndSkip );
+        CPPUNIT_TEST_SUITE_END();
+    };                          // class file_inputstream_test
+
+    void file_inputstream_test::setUp()
+    {
+        m_aTempFile.EnableKillingFile();
+        SvStream* pStream = m_aTempFile.GetStream( StreamMode::WRITE );
+        std::vector< sal_Int8 > aData( FILE_SIZE );
+        for ( sal_Int32 i = 0; i < FILE_SIZE; ++i )
+            aData[i] = patternAt( i );
+        pStream->WriteBytes( aData.data(), aData.size() );
+        m_aTempFile.CloseStream();
+    }
+
+    void file_inputstream_test::tearDown()
+    {
+    }
+
+    void file_inputstream_test::checkRead( const rtl::Reference< XInputStream_impl >& xStream,
+                                           sal_Int64& rPos, sal_Int32 nBytes )
+    {
+        uno::Sequence< sal_Int8 > aData;
+        const sal_Int32 nExpected
+            = static_cast< sal_Int32 >( std::min< sal_Int64 >( nBytes, FILE_SIZE - rPos ) );
+        CPPUNIT_ASSERT_EQUAL( nExpected, xStream->readBytes( aData, nBytes ) );
+        CPPUNIT_ASSERT_EQUAL( nExpected, aData.getLength() );
+        for ( sal_Int32 i = 0; i < nExpected; ++i )
+            CPPUNIT_ASSERT_EQUAL( patternAt( rPos + i ), aData[i] );
+        rPos += nExpected;
+        CPPUNIT_ASSERT_EQUAL( rPos, xStream->getPosition() );
+    }
+
+    void file_inputstream_test::ReadAheadSeekAndSkip()
+    {
+        rtl::Reference< XInputStream_impl > xStream
+            = new XInputStream_impl( m_aTempFile.GetURL(), false );
+        CPPUNIT_ASSERT_EQUAL( sal_Int64( FILE_SIZE ), xStream->getLength() );
+
+        sal_Int64 nPos = 0;
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+
+        // small reads, served from the buffer after the first one
+        checkRead( xStream, nPos, 10 );
+        checkRead( xStream, nPos, 100 );
+
+        // backward seek inside the buffer
+        nPos = 50;
+        xStream->seek( nPos );
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+        checkRead( xStream, nPos, 20 );
+
+        // forward seek, still inside the buffer
+        nPos = 200000;
+        xStream->seek( nPos );
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+        checkRead( xStream, nPos, 16 );
+
+        // forward seek outside the buffer
+        nPos = 600000;
+        xStream->seek( nPos );
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+        checkRead( xStream, nPos, 8 );
+
+        // backward seek outside the buffer
+        nPos = 10;
+        xStream->seek( nPos );
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+        checkRead( xStream, nPos, 8 );
+
+        // skip inside the buffer
+        xStream->skipBytes( 1000 );
+        nPos += 1000;
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+        checkRead( xStream, nPos, 4 );
+
+        // skip across the end of the buffer
+        xStream->skipBytes( 300000 );
+        nPos += 300000;
+        CPPUNIT_ASSERT_EQUAL( nPos, xStream->getPosition() );
+        checkRead( xStream, nPos, 4 );
+
+        // large read after a partially consumed buffer: the rest of the
+        // buffer is used first and the remainder, which is larger than the
+        // buffer, is read directly
+        checkRead( xStream, nPos, 600000 );
+        checkRead( xStream, nPos, 10 );
+
+        // the available bytes include the buffered ones
+        CPPUNIT_ASSERT_EQUAL( sal_Int32( FILE_SIZE - nPos ), xStream->available() );
+
+        // read past the end of the file
+        nPos = FILE_SIZE - 5;
+        xStream->seek( nPos );
+        checkRead( xStream, nPos, 10 );
+        CPPUNIT_ASSERT_EQUAL( sal_Int64( FILE_SIZE ), nPos );
+
+        uno::Sequence< sal_Int8 > aData;
+        CPPUNIT_ASSERT_EQUAL( sal_Int32( 0 ), xStream->readBytes( aData, 10 ) );
+        CPPUNIT_ASSERT_EQUAL( sal_Int32( 0 ), xStream->available() );
+
+        xStream->closeInput();
+    }
+
+    CPPUNIT_TEST_SUITE_REGISTRATION( file_inputstream_test );
+}                               // namespace
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -25,6 +25,9 @@
 #include "filinpstr.hxx"
 #include "filerror.hxx"
 
+#include <algorithm>
+#include <cstring>
+
 using namespace fileaccess;
 using namespace com::sun::star;
 
@@ -34,8 +37,18 @@ using namespace com::sun::star;
 #define THROW_WHERE ""
 #endif
 
+namespace {
+
+// Consumers like the zip package code read in small pieces; fetch at least
+// this much per call to the file, which matters a lot on high latency storage.
+constexpr sal_Int32 READ_AHEAD_SIZE = 256 * 1024;
+
+}
+
 XInputStream_impl::XInputStream_impl( const OUString& aUncPath, bool bLock )
     : m_aFile( aUncPath ),
+      m_nReadAheadLen( 0 ),
+      m_nReadAheadPos( 0 ),
       m_nErrorCode( TASKHANDLER_NO_ERROR ),
       m_nMinorErrorCode( TASKHANDLER_NO_ERROR )
 {
@@ -84,17 +97,49 @@ XInputStream_impl::readBytes(
         //TODO! translate memory exhaustion (if it were detectable...) into
         // io::BufferSizeExceededException
 
-    sal_uInt64 nrc(0);
-    if(m_aFile.read( aData.getArray(),sal_uInt64(nBytesToRead),nrc )
-       != osl::FileBase::E_None)
-        throw io::IOException( THROW_WHERE );
+    sal_Int8* pData = aData.getArray();
+    sal_Int32 nRead = std::min(m_nReadAheadLen - m_nReadAheadPos, nBytesToRead);
+    if (nRead > 0)
+    {
+        memcpy(pData, m_pReadAhead.get() + m_nReadAheadPos, nRead);
+        m_nReadAheadPos += nRead;
+    }
+
+    if (nRead < nBytesToRead)
+    {
+        // the buffer is used up now, so the file is at the logical position
+        discardReadAhead();
+
+        sal_Int32 nMissing = nBytesToRead - nRead;
+        sal_uInt64 nrc(0);
+        if (nMissing >= READ_AHEAD_SIZE)
+        {
+            // large reads gain nothing from going through the buffer
+            if(m_aFile.read( pData + nRead,sal_uInt64(nMissing),nrc )
+               != osl::FileBase::E_None)
+                throw io::IOException( THROW_WHERE );
+            nRead += static_cast<sal_Int32>(nrc);
+        }
+        else
+        {
+            if (!m_pReadAhead)
+                m_pReadAhead.reset(new sal_Int8[READ_AHEAD_SIZE]);
+            if(m_aFile.read( m_pReadAhead.get(),sal_uInt64(READ_AHEAD_SIZE),nrc )
+               != osl::FileBase::E_None)
+                throw io::IOException( THROW_WHERE );
+            m_nReadAheadLen = static_cast<sal_Int32>(nrc);
+            m_nReadAheadPos = std::min(m_nReadAheadLen, nMissing);
+            memcpy(pData + nRead, m_pReadAhead.get(), m_nReadAheadPos);
+            nRead += m_nReadAheadPos;
+        }
+    }
 
     // Shrink aData in case we read less than nBytesToRead (XInputStream
     // documentation does not tell whether this is required, and I do not know
     // if any code relies on this, so be conservative---SB):
-    if (sal::static_int_cast<sal_Int32>(nrc) != nBytesToRead)
-        aData.realloc(sal_Int32(nrc));
-    return static_cast<sal_Int32>(nrc);
+    if (nRead != nBytesToRead)
+        aData.realloc(nRead);
+    return nRead;
 }
 
 sal_Int32 SAL_CALL
@@ -109,7 +154,14 @@ XInputStream_impl::readSomeBytes(
 void SAL_CALL
 XInputStream_impl::skipBytes( sal_Int32 nBytesToSkip )
 {
-    m_aFile.setPos( osl_Pos_Current, sal_uInt64( nBytesToSkip ) );
+    sal_Int32 nBuffered = m_nReadAheadLen - m_nReadAheadPos;
+    if (nBytesToSkip >= 0 && nBytesToSkip <= nBuffered)
+    {
+        m_nReadAheadPos += nBytesToSkip;
+        return;
+    }
+    m_aFile.setPos( osl_Pos_Current, sal_Int64( nBytesToSkip ) - nBuffered );
+    discardReadAhead();
 }
 
 
@@ -130,6 +182,7 @@ XInputStream_impl::closeInput()
         if( err != osl::FileBase::E_None )
             throw io::IOException( THROW_WHERE );
         m_nIsOpen = false;
+        discardReadAhead();
     }
 }
 
@@ -139,6 +192,20 @@ XInputStream_impl::seek( sal_Int64 location )
 {
     if( location < 0 )
         throw lang::IllegalArgumentException( THROW_WHERE, uno::Reference< uno::XInterface >(), 0 );
+    if( m_nReadAheadLen > 0 )
+    {
+        // stay inside the buffer if possible, zip parsers seek back and forth a lot
+        sal_uInt64 uPos;
+        if( osl::FileBase::E_None != m_aFile.getPos( uPos ) )
+            throw io::IOException( THROW_WHERE );
+        sal_Int64 nBufferStart = sal_Int64( uPos ) - m_nReadAheadLen;
+        if( location >= nBufferStart && location <= sal_Int64( uPos ) )
+        {
+            m_nReadAheadPos = static_cast<sal_Int32>( location - nBufferStart );
+            return;
+        }
+    }
+    discardReadAhead();
     if( osl::FileBase::E_None != m_aFile.setPos( osl_Pos_Absolut, sal_uInt64( location ) ) )
         throw io::IOException( THROW_WHERE );
 }
@@ -150,7 +217,7 @@ XInputStream_impl::getPosition()
     sal_uInt64 uPos;
     if( osl::FileBase::E_None != m_aFile.getPos( uPos ) )
         throw io::IOException( THROW_WHERE );
-    return sal_Int64( uPos );
+    return sal_Int64( uPos ) - ( m_nReadAheadLen - m_nReadAheadPos );
 }
 
 sal_Int64 SAL_CALL
@@ -162,4 +229,10 @@ XInputStream_impl::getLength()
     return sal_Int64( uEndPos );
 }
 
+void XInputStream_impl::discardReadAhead()
+{
+    m_nReadAheadLen = 0;
+    m_nReadAheadPos = 0;
+}
+
 /* vim:set shiftwidth=4 softtabstop=4 expandtab: */
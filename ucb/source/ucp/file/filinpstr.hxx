@@ -20,6 +20,7 @@
 
 #include <rtl/ustring.hxx>
 #include <cppuhelper/implbase.hxx>
+#include <memory>
 #include <com/sun/star/io/XSeekable.hpp>
 #include <com/sun/star/io/XInputStream.hpp>
 
@@ -75,10 +76,21 @@ namespace fileaccess {
 
     private:
 
+        /** Forget the buffered data, after the file position has been moved. */
+        void discardReadAhead();
+
         bool                                               m_nIsOpen;
 
         ReconnectingFile                                   m_aFile;
 
+        /** Read-ahead buffer for small reads, allocated on first use. The file
+            position is always at the end of the buffered data, so the logical
+            stream position is that minus (m_nReadAheadLen - m_nReadAheadPos).
+         */
+        std::unique_ptr<sal_Int8[]>                        m_pReadAhead;
+        sal_Int32                                          m_nReadAheadLen;
+        sal_Int32                                          m_nReadAheadPos;
+
         sal_Int32                                          m_nErrorCode;
         sal_Int32                                          m_nMinorErrorCode;
     };
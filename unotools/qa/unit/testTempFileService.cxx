@@ -0,0 +1,64 @@
+/* -*- Mode: C++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+/*
+ * This file is part of the LibreOffice project.
+ *
+ * This Source Code Form is subject to the terms of the Mozilla Public
+ * License, v. 2.0. If a copy of the MPL was not distributed with this
+ * file, You can obtain one at http://mozilla.org/MPL/2.0/.
+ *
+ */
+
+#include <test/bootstrapfixture.hxx>
+#include <cppunit/plugin/TestPlugIn.h>
+
+#include <com/sun/star/io/TempFile.hpp>
+#include <com/sun/star/io/XTempFile.hpp>
+#include <comphelper/processfactory.hxx>
+#include <tools/stream.hxx>
+
+using namespace css;
+
+namespace
+{
+class TempFileServiceTest : public test::BootstrapFixture
+{
+public:
+    void testSmallDataReachesFile();
+
+    CPPUNIT_TEST_SUITE(TempFileServiceTest);
+    CPPUNIT_TEST(testSmallDataReachesFile);
+    CPPUNIT_TEST_SUITE_END();
+};
+
+void TempFileServiceTest::testSmallDataReachesFile()
+{
+    uno::Reference<io::XTempFile> xTempFile
+        = io::TempFile::create(comphelper::getProcessComponentContext());
+    const uno::Sequence<sal_Int8> aData{ 'a', 'b', 'c', 'd', 'e' };
+    xTempFile->getOutputStream()->writeBytes(aData);
+    xTempFile->getOutputStream()->closeOutput();
+
+    // The data is held in memory until now; asking for the URL has to put
+    // all of it into the file, even though it fits into the stream buffer.
+    OUString aURL = xTempFile->getUri();
+    CPPUNIT_ASSERT(!aURL.isEmpty());
+
+    SvFileStream aStream(aURL, StreamMode::READ | StreamMode::SHARE_DENYNONE);
+    CPPUNIT_ASSERT_EQUAL(sal_uInt64(aData.getLength()), aStream.TellEnd());
+    char aBuffer[5] = {};
+    CPPUNIT_ASSERT_EQUAL(std::size_t(5), aStream.ReadBytes(aBuffer, 5));
+    for (sal_Int32 i = 0; i < aData.getLength(); ++i)
+        CPPUNIT_ASSERT_EQUAL(static_cast<char>(aData[i]), aBuffer[i]);
+
+    // the temp file service can still read what was written
+    uno::Sequence<sal_Int8> aRead;
+    CPPUNIT_ASSERT_EQUAL(sal_Int32(5), xTempFile->getInputStream()->readBytes(aRead, 10));
+    CPPUNIT_ASSERT(aData == aRead);
+}
+
+CPPUNIT_TEST_SUITE_REGISTRATION(TempFileServiceTest);
+}
+
+CPPUNIT_PLUGIN_IMPLEMENT();
+
+/* vim:set shiftwidth=4 softtabstop=4 expandtab: */
@@ -23,23 +23,41 @@
 #include <tools/diagnose_ex.h>
 
 #include <com/sun/star/i18n/CharacterClassification.hpp>
+#include <algorithm>
 #include <utility>
 
 using namespace ::com::sun::star;
 using namespace ::com::sun::star::i18n;
 using namespace ::com::sun::star::uno;
 
+static bool lcl_hasAsciiCaseMapping( const LanguageTag& rLanguageTag )
+{
+    // Turkish, Azeri and Lithuanian have special casing rules for I, i and J.
+    const OUString aLanguage = rLanguageTag.getLanguage();
+    return aLanguage != "tr" && aLanguage != "az" && aLanguage != "lt";
+}
+
+static bool lcl_isAsciiRange( const OUString& rStr, sal_Int32 nPos, sal_Int32 nCount )
+{
+    if (nPos < 0 || nCount < 0 || nCount > rStr.getLength() - nPos)
+        return false;
+    const sal_Unicode* p = rStr.getStr() + nPos;
+    return std::all_of(p, p + nCount, [](sal_Unicode c) { return rtl::isAscii(c); });
+}
+
 CharClass::CharClass(
             const Reference< uno::XComponentContext > & rxContext,
             LanguageTag aLanguageTag
             )
     : maLanguageTag(std::move( aLanguageTag))
+    , mbAsciiCaseMapping(lcl_hasAsciiCaseMapping(maLanguageTag))
 {
     xCC = CharacterClassification::create( rxContext );
 }
 
 CharClass::CharClass( LanguageTag aLanguageTag )
     : maLanguageTag(std::move( aLanguageTag))
+    , mbAsciiCaseMapping(lcl_hasAsciiCaseMapping(maLanguageTag))
 {
     xCC = CharacterClassification::create( comphelper::getProcessComponentContext() );
 }
@@ -238,6 +256,10 @@ OUString CharClass::titlecase(const OUString& rStr, sal_Int32 nPos, sal_Int32 nC
 
 OUString CharClass::uppercase( const OUString& rStr, sal_Int32 nPos, sal_Int32 nCount ) const
 {
+    // Plain ASCII, as most cell strings are, does not need the UNO round trip.
+    if (mbAsciiCaseMapping && lcl_isAsciiRange(rStr, nPos, nCount))
+        return rStr.copy(nPos, nCount).toAsciiUpperCase();
+
     try
     {
         return xCC->toUpper( rStr, nPos, nCount, getMyLocale() );
@@ -251,6 +273,9 @@ OUString CharClass::uppercase( const OUString& rStr, sal_Int32 nPos, sal_Int32 n
 
 OUString CharClass::lowercase( const OUString& rStr, sal_Int32 nPos, sal_Int32 nCount ) const
 {
+    if (mbAsciiCaseMapping && lcl_isAsciiRange(rStr, nPos, nCount))
+        return rStr.copy(nPos, nCount).toAsciiLowerCase();
+
     try
     {
         return xCC->toLower( rStr, nPos, nCount, getMyLocale() );
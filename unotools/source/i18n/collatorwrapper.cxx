@@ -22,12 +22,14 @@
 #include <sal/log.hxx>
 #include <unotools/collatorwrapper.hxx>
 #include <com/sun/star/i18n/Collator.hpp>
+#include <com/sun/star/i18n/XExtendedCollator.hpp>
 
 using namespace ::com::sun::star;
 
 CollatorWrapper::CollatorWrapper ( const uno::Reference< uno::XComponentContext > &rxContext )
 {
     mxInternationalCollator = i18n::Collator::create( rxContext );
+    mxExtendedCollator.set( mxInternationalCollator, uno::UNO_QUERY );
 }
 
 sal_Int32
@@ -46,6 +48,22 @@ CollatorWrapper::compareString (const OUString& s1, const OUString& s2) const
     return 0;
 }
 
+uno::Sequence< sal_Int8 >
+CollatorWrapper::getSortKey (const OUString& rStr) const
+{
+    try
+    {
+        if (mxExtendedCollator.is())
+            return mxExtendedCollator->getSortKey (rStr);
+    }
+    catch (const uno::RuntimeException&)
+    {
+        SAL_WARN( "unotools.i18n","CollatorWrapper: getSortKey failed");
+    }
+
+    return uno::Sequence< sal_Int8 > ();
+}
+
 uno::Sequence< OUString >
 CollatorWrapper::listCollatorAlgorithms (const lang::Locale& rLocale) const
 {
@@ -28,12 +28,14 @@
 #include <com/sun/star/beans/XFastPropertySet.hpp>
 #include <com/sun/star/lang/XServiceInfo.hpp>
 #include <cppuhelper/implbase.hxx>
+#include <memory>
 #include <mutex>
 #include <unotools/tempfile.hxx>
 
 namespace com::sun::star::uno { class XComponentContext; }
 
 class SvStream;
+class SvMemoryStream;
 namespace utl { class TempFile; }
 
 
@@ -50,6 +52,10 @@ class OTempFileService : public OTempFileBase
 {
 protected:
     std::optional<utl::TempFile> mpTempFile;
+    /// Holds the data until it gets too large or a file is asked for, see spillToFile()
+    std::unique_ptr<SvMemoryStream> mpMemStream;
+    /// How much of the shared in-memory budget mpMemStream currently accounts for
+    sal_Int64 mnMemBudgetUsed;
     std::mutex maMutex;
     SvStream* mpStream;
     bool mbRemoveFile;
@@ -58,6 +64,10 @@ protected:
 
     void checkError () const;
     void checkConnected ();
+    /// Moves the data from the memory stream into a real temp file
+    void spillToFile ();
+    /// Drops the memory stream and gives its size back to the shared budget
+    void releaseMemStream ();
 
 public:
     explicit OTempFileService (css::uno::Reference< css::uno::XComponentContext > const & context);
@@ -26,19 +26,52 @@
 #include <unotools/tempfile.hxx>
 #include <cppuhelper/propshlp.hxx>
 #include <cppuhelper/supportsservice.hxx>
+#include <sal/log.hxx>
+#include <tools/stream.hxx>
+
+#include <algorithm>
+#include <atomic>
+
+namespace {
+
+/// Temp files are kept in memory as long as all of them together stay below this size.
+/// This is fixed for now; there is no configuration setting for it.
+constexpr sal_Int64 IN_MEMORY_BUDGET = 64 * 1024 * 1024;
+
+std::atomic<sal_Int64> gnInMemoryTotal(0);
+/// Number of temp files moved to disk so far, only reported in the SAL_INFO log of spillToFile()
+std::atomic<sal_Int32> gnSpillCount(0);
+
+/// Adjusts the shared budget from rnUsed to nNewSize bytes, if it allows that
+bool changeMemoryBudget( sal_Int64& rnUsed, sal_Int64 nNewSize )
+{
+    sal_Int64 nDiff = nNewSize - rnUsed;
+    if ( nDiff > 0 && gnInMemoryTotal.fetch_add( nDiff ) + nDiff > IN_MEMORY_BUDGET )
+    {
+        gnInMemoryTotal -= nDiff;
+        return false;
+    }
+    if ( nDiff < 0 )
+        gnInMemoryTotal += nDiff;
+    rnUsed = nNewSize;
+    return true;
+}
+
+}
 
 OTempFileService::OTempFileService(css::uno::Reference< css::uno::XComponentContext > const &)
-: mpStream( nullptr )
+: mpMemStream( new SvMemoryStream )
+, mnMemBudgetUsed( 0 )
+, mpStream( mpMemStream.get() )
 , mbRemoveFile( true )
 , mbInClosed( false )
 , mbOutClosed( false )
 {
-    mpTempFile.emplace();
-    mpTempFile->EnableKillingFile();
 }
 
 OTempFileService::~OTempFileService ()
 {
+    releaseMemStream();
 }
 
 //  XTypeProvider
@@ -58,7 +91,7 @@ sal_Bool SAL_CALL OTempFileService::getRemoveFile()
 {
     std::unique_lock aGuard( maMutex );
 
-    if ( !mpTempFile )
+    if ( !mpTempFile && !mpMemStream )
     {
         // the stream is already disconnected
         throw css::uno::RuntimeException("Not connected to a file.");
@@ -70,24 +103,27 @@ void SAL_CALL OTempFileService::setRemoveFile( sal_Bool _removefile )
 {
     std::unique_lock aGuard( maMutex );
 
-    if ( !mpTempFile )
+    if ( !mpTempFile && !mpMemStream )
     {
         // the stream is already disconnected
         throw css::uno::RuntimeException("Not connected to a file.");
     }
 
     mbRemoveFile = _removefile;
-    mpTempFile->EnableKillingFile( mbRemoveFile );
+    if ( mpTempFile )
+        mpTempFile->EnableKillingFile( mbRemoveFile );
 };
 OUString SAL_CALL OTempFileService::getUri()
 {
     std::unique_lock aGuard( maMutex );
 
-    if ( !mpTempFile )
+    if ( !mpTempFile && !mpMemStream )
     {
         throw css::uno::RuntimeException("Not connected to a file.");
     }
 
+    // the caller wants to access the file itself
+    spillToFile();
     return mpTempFile->GetURL();
 
 };
@@ -95,11 +131,13 @@ OUString SAL_CALL OTempFileService::getResourceName()
 {
     std::unique_lock aGuard( maMutex );
 
-    if ( !mpTempFile )
+    if ( !mpTempFile && !mpMemStream )
     {
         throw css::uno::RuntimeException("Not connected to a file.");
     }
 
+    // the caller wants to access the file itself
+    spillToFile();
     return mpTempFile->GetFileName();
 };
 
@@ -184,6 +222,7 @@ void SAL_CALL OTempFileService::closeInput(  )
         // stream will be deleted by TempFile implementation
         mpStream = nullptr;
         mpTempFile.reset();
+        releaseMemStream();
     }
 }
 
@@ -196,6 +235,13 @@ void SAL_CALL OTempFileService::writeBytes( const css::uno::Sequence< sal_Int8 >
         throw css::io::NotConnectedException ( OUString(), static_cast < css::uno::XWeak * > (this ) );
 
     checkConnected();
+    if ( mpMemStream )
+    {
+        sal_Int64 nNewSize = std::max<sal_Int64>( mpMemStream->TellEnd(),
+                                                  mpMemStream->Tell() + aData.getLength() );
+        if ( !changeMemoryBudget( mnMemBudgetUsed, nNewSize ) )
+            spillToFile();
+    }
     sal_uInt32 nWritten = mpStream->WriteBytes(aData.getConstArray(), aData.getLength());
     checkError();
     if  ( nWritten != static_cast<sal_uInt32>(aData.getLength()))
@@ -230,6 +276,7 @@ void SAL_CALL OTempFileService::closeOutput(  )
         // stream will be deleted by TempFile implementation
         mpStream = nullptr;
         mpTempFile.reset();
+        releaseMemStream();
     }
 }
 
@@ -238,6 +285,42 @@ void OTempFileService::checkError () const
     if (!mpStream || mpStream->SvStream::GetError () != ERRCODE_NONE )
         throw css::io::NotConnectedException ( OUString(), const_cast < css::uno::XWeak * > ( static_cast < const css::uno::XWeak * > (this ) ) );
 }
+void OTempFileService::spillToFile ()
+{
+    if ( !mpMemStream )
+        return;
+
+    mpTempFile.emplace();
+    mpTempFile->EnableKillingFile( mbRemoveFile );
+    // Ideally we should open this SHARE_DENYALL, but the JunitTest_unotools_complex test wants to open
+    // this file directly and read from it.
+    SvStream* pFileStream = mpTempFile->GetStream(StreamMode::READ | StreamMode::WRITE
+                                                  | StreamMode::SHARE_DENYWRITE);
+    sal_uInt64 nPos = mpMemStream->Tell();
+    sal_uInt64 nSize = mpMemStream->TellEnd();
+    pFileStream->WriteBytes( mpMemStream->GetData(), nSize );
+    // small payloads would otherwise stay in the stream buffer, and callers
+    // that ask for the Uri expect to find the data in the file
+    pFileStream->Flush();
+    pFileStream->Seek( nPos );
+    releaseMemStream();
+    mpStream = pFileStream;
+
+    SAL_INFO("unotools.ucbhelper", "temp file moved to disk at " << nSize << " bytes, "
+             << ++gnSpillCount << " so far");
+    checkError();
+}
+
+void OTempFileService::releaseMemStream ()
+{
+    if ( !mpMemStream )
+        return;
+    if ( mpStream == mpMemStream.get() )
+        mpStream = nullptr;
+    mpMemStream.reset();
+    changeMemoryBudget( mnMemBudgetUsed, 0 );
+}
+
 void OTempFileService::checkConnected ()
 {
     if (!mpStream && mpTempFile)
@@ -309,6 +392,8 @@ void SAL_CALL OTempFileService::truncate()
     mpStream->Seek( 0 );
     mpStream->SetStreamSize( 0 );
     checkError();
+    if ( mpMemStream )
+        changeMemoryBudget( mnMemBudgetUsed, 0 );
 }
 
 #define PROPERTY_HANDLE_URI 1